@@ -0,0 +1,465 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <charconv>
+#include <algorithm>
+#include <memory>
+
+using namespace std;
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    double availableTime; // Time when UAV is available again
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time; // Min-heap based on time
+    }
+};
+
+// One dispatch decision, handed to whichever result sink is active
+struct DispatchRecord
+{
+    int uavId; // -1 when the outpost could not be reached
+    int outpostId;
+    double distance;
+    double energyCost;
+    double travelTime;
+    double availableAgain;
+};
+
+// Totals printed at the end of every run (and the only output in quiet mode)
+struct RunSummary
+{
+    long long assigned = 0;
+    long long unreachable = 0;
+    double totalEnergy = 0;
+    double makespan = 0;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Buffered writer: records are formatted straight into a byte buffer and
+// handed to the FILE only when the buffer fills up (no per-record flush)
+class OutputBuffer
+{
+public:
+    explicit OutputBuffer(FILE *out) : out(out), buffer(1 << 16), pos(0) {}
+    ~OutputBuffer() { flush(); }
+
+    void put(const char *data, size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+        if (n > buffer.size())
+        {
+            fwrite(data, 1, n, out);
+            return;
+        }
+        memcpy(buffer.data() + pos, data, n);
+        pos += n;
+    }
+
+    void put(const char *text) { put(text, strlen(text)); }
+
+    // Numbers are formatted in place; 32 bytes covers any int64 or double
+    void putInt(long long value)
+    {
+        reserve(32);
+        auto result = to_chars(buffer.data() + pos, buffer.data() + buffer.size(), value);
+        pos = result.ptr - buffer.data();
+    }
+
+    // Shortest round-trip form by default; precision > 0 mimics cout (%g)
+    void putDouble(double value, int precision = 0)
+    {
+        reserve(32);
+        char *first = buffer.data() + pos;
+        char *last = buffer.data() + buffer.size();
+        auto result = precision > 0 ? to_chars(first, last, value, chars_format::general, precision)
+                                    : to_chars(first, last, value);
+        pos = result.ptr - buffer.data();
+    }
+
+    template <typename T>
+    void putRaw(const T &value) { put(reinterpret_cast<const char *>(&value), sizeof(T)); }
+
+    void reserve(size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+    }
+
+    void flush()
+    {
+        if (pos > 0)
+            fwrite(buffer.data(), 1, pos, out);
+        pos = 0;
+        fflush(out);
+    }
+
+private:
+    FILE *out;
+    vector<char> buffer;
+    size_t pos;
+};
+
+// Pluggable result sink; one implementation per output format
+class ResultSink
+{
+public:
+    explicit ResultSink(FILE *out) : buf(out) {}
+    virtual ~ResultSink() = default;
+    virtual void begin() {}
+    virtual void write(const DispatchRecord &record) = 0;
+    virtual void end() { buf.flush(); }
+
+protected:
+    OutputBuffer buf;
+};
+
+// Same lines as v8, but buffered and without endl
+class TextSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("\nBest UAV Allocation:\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId < 0)
+        {
+            buf.put("⚠️ Warning: Outpost ");
+            buf.putInt(r.outpostId);
+            buf.put(" could not be reached due to UAV constraints.\n");
+            return;
+        }
+        buf.put("UAV ");
+        buf.putInt(r.uavId);
+        buf.put(" assigned to Outpost ");
+        buf.putInt(r.outpostId);
+        buf.put(" | Distance: ");
+        buf.putDouble(r.distance, 6);
+        buf.put(" | Energy Cost: ");
+        buf.putDouble(r.energyCost, 6);
+        buf.put(" | Travel Time: ");
+        buf.putDouble(r.travelTime, 6);
+        buf.put(" | Available Again At: ");
+        buf.putDouble(r.availableAgain, 6);
+        buf.put("\n");
+    }
+};
+
+class CsvSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("uav_id,outpost_id,distance,energy_cost,travel_time,available_again\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId >= 0)
+            buf.putInt(r.uavId);
+        buf.put(",");
+        buf.putInt(r.outpostId);
+        buf.put(",");
+        buf.putDouble(r.distance);
+        buf.put(",");
+        if (r.uavId >= 0)
+        {
+            buf.putDouble(r.energyCost);
+            buf.put(",");
+            buf.putDouble(r.travelTime);
+            buf.put(",");
+            buf.putDouble(r.availableAgain);
+        }
+        else
+        {
+            buf.put(",,");
+        }
+        buf.put("\n");
+    }
+};
+
+class JsonLinesSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void write(const DispatchRecord &r) override
+    {
+        buf.put("{\"outpost\":");
+        buf.putInt(r.outpostId);
+        if (r.uavId < 0)
+        {
+            buf.put(",\"uav\":null,\"reached\":false}\n");
+            return;
+        }
+        buf.put(",\"uav\":");
+        buf.putInt(r.uavId);
+        buf.put(",\"distance\":");
+        buf.putDouble(r.distance);
+        buf.put(",\"energy_cost\":");
+        buf.putDouble(r.energyCost);
+        buf.put(",\"travel_time\":");
+        buf.putDouble(r.travelTime);
+        buf.put(",\"available_again\":");
+        buf.putDouble(r.availableAgain);
+        buf.put(",\"reached\":true}\n");
+    }
+};
+
+// Binary allocation format: 8-byte header ("UAVA", uint32 version = 1)
+// followed by fixed 40-byte records in host byte order:
+// int32 uav_id (-1 = unreachable), int32 outpost_id, then four float64
+// (distance, energy_cost, travel_time, available_again)
+class BinarySink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override
+    {
+        buf.put("UAVA", 4);
+        buf.putRaw<uint32_t>(1);
+    }
+
+    void write(const DispatchRecord &r) override
+    {
+        buf.putRaw<int32_t>(r.uavId);
+        buf.putRaw<int32_t>(r.outpostId);
+        buf.putRaw(r.distance);
+        buf.putRaw(r.energyCost);
+        buf.putRaw(r.travelTime);
+        buf.putRaw(r.availableAgain);
+    }
+};
+
+unique_ptr<ResultSink> makeSink(const string &format, FILE *out)
+{
+    if (format == "text")
+        return make_unique<TextSink>(out);
+    if (format == "csv")
+        return make_unique<CsvSink>(out);
+    if (format == "jsonl")
+        return make_unique<JsonLinesSink>(out);
+    if (format == "bin")
+        return make_unique<BinarySink>(out);
+    return nullptr;
+}
+
+void printSummary(FILE *out, const RunSummary &summary)
+{
+    OutputBuffer buf(out);
+    buf.put("Assigned: ");
+    buf.putInt(summary.assigned);
+    buf.put(" | Unreachable: ");
+    buf.putInt(summary.unreachable);
+    buf.put(" | Total Energy: ");
+    buf.putDouble(summary.totalEnergy, 6);
+    buf.put(" | Makespan: ");
+    buf.putDouble(summary.makespan, 6);
+    buf.put("\n");
+}
+
+int main(int argc, char **argv)
+{
+    // Output options: --format=text|csv|jsonl|bin  --output=<file>  --quiet
+    string format = "text";
+    string outputPath;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--format=", 0) == 0)
+            format = arg.substr(9);
+        else if (arg.rfind("--output=", 0) == 0)
+            outputPath = arg.substr(9);
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    FILE *out = stdout;
+    if (!outputPath.empty())
+    {
+        out = fopen(outputPath.c_str(), format == "bin" ? "wb" : "w");
+        if (!out)
+        {
+            cerr << "Cannot open output file: " << outputPath << "\n";
+            return 1;
+        }
+    }
+
+    unique_ptr<ResultSink> sink;
+    if (!quiet)
+    {
+        sink = makeSink(format, out);
+        if (!sink)
+        {
+            cerr << "Unknown format: " << format << " (expected text, csv, jsonl or bin)\n";
+            return 1;
+        }
+    }
+
+    // Prompts only make sense for the interactive text layout
+    bool interactive = format == "text" && !quiet;
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    if (interactive)
+        cout << "Enter number of outposts: " << flush;
+    cin >> numOutposts;
+    if (interactive)
+        cout << "Enter number of UAVs: " << flush;
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    if (interactive)
+        cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n" << flush;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+        uavs[i].availableTime = 0; // Initially all UAVs are available
+    }
+
+    double baseX, baseY;
+    if (interactive)
+        cout << "Enter Base Station coordinates (x y): " << flush;
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    if (interactive)
+        cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n" << flush;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    // Sort outposts by priority (descending)
+    sort(outposts.begin(), outposts.end(), [](const Outpost &a, const Outpost &b)
+         { return a.priority > b.priority; });
+
+    // Min-heap to track UAV availability based on earliest available time
+    priority_queue<Task, vector<Task>, greater<Task>> pq;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        pq.push({0, i}); // All UAVs start at time 0
+    }
+
+    if (sink)
+        sink->begin();
+
+    RunSummary summary;
+    vector<Task> tempUAVs; // Store popped elements to push them back later
+
+    for (const auto &outpost : outposts)
+    {
+        bool assigned = false;
+        int selectedUAV = -1;
+        double selectedEnergyUsed = 0;
+        double selectedTravelTime = 0;
+        double distance = calculateDistance(baseX, baseY, outpost.x, outpost.y);
+
+        tempUAVs.clear();
+
+        while (!pq.empty())
+        {
+            auto [availableTime, uavIndex] = pq.top();
+            pq.pop();
+            UAV &uav = uavs[uavIndex];
+
+            double energyCost = distance * uav.energyPerKm * 2; // Round trip
+            double travelTime = distance / 10.0;                // Assume 10 units speed
+
+            if (energyCost <= uav.totalEnergy)
+            {
+                assigned = true;
+                selectedUAV = uavIndex;
+                selectedEnergyUsed = energyCost;
+                selectedTravelTime = travelTime;
+
+                // Update UAV availability
+                uav.availableTime = availableTime + (2 * travelTime);
+                pq.push({uav.availableTime, uavIndex});
+                break;
+            }
+            else
+            {
+                tempUAVs.push_back({availableTime, uavIndex});
+            }
+        }
+
+        // Push back UAVs that were not selected
+        for (auto &task : tempUAVs)
+        {
+            pq.push(task);
+        }
+
+        DispatchRecord record{-1, outpost.id, distance, 0, 0, 0};
+        if (assigned)
+        {
+            record.uavId = uavs[selectedUAV].id;
+            record.energyCost = selectedEnergyUsed;
+            record.travelTime = selectedTravelTime;
+            record.availableAgain = uavs[selectedUAV].availableTime;
+
+            summary.assigned++;
+            summary.totalEnergy += selectedEnergyUsed;
+            summary.makespan = max(summary.makespan, record.availableAgain);
+        }
+        else
+        {
+            summary.unreachable++;
+        }
+
+        if (sink)
+            sink->write(record);
+    }
+
+    if (sink)
+        sink->end();
+
+    // Keep machine-readable stdout clean: summary goes to stderr unless the
+    // records are plain text or written to a file
+    FILE *summaryOut = (quiet || format == "text" || out != stdout) ? stdout : stderr;
+    printSummary(summaryOut, summary);
+
+    sink.reset();
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
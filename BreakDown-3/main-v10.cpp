@@ -0,0 +1,579 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <algorithm>
+#include <memory>
+
+using namespace std;
+
+// Lookahead defaults (overridable with --lookahead=K and --branch=B)
+const int DEFAULT_LOOKAHEAD = 3; // Dispatch decisions simulated ahead of the current one
+const int DEFAULT_BRANCH = 3;    // Candidate outposts tried per simulated decision
+const int SCAN_LIMIT = 256;      // Pending outposts scanned when collecting candidates
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    double speed;         // Distance units per time unit
+    double availableTime; // Time when UAV is available again
+    double busyTime;      // Total time spent flying
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+    double windowStart, windowEnd; // Delivery must arrive within [windowStart, windowEnd]
+    double distance;               // Distance from base, computed once
+};
+
+// UAV availability event (min-heap on time)
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time;
+    }
+};
+
+// A concrete sortie: depart (possibly delayed to hit the window), deliver, return
+struct Trip
+{
+    bool feasible;
+    double energyCost;
+    double depart, arrive, ret;
+};
+
+struct DispatchRecord
+{
+    int uavId; // -1 when the outpost was missed
+    int outpostId;
+    double distance;
+    double energyCost;
+    double depart, arrive, availableAgain;
+};
+
+struct RunSummary
+{
+    long long assigned = 0;
+    long long missed = 0;
+    double totalEnergy = 0;
+    double makespan = 0;
+    double busyTime = 0;
+    int fleetSize = 0;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+Trip planTrip(const UAV &uav, const Outpost &outpost, double readyTime)
+{
+    Trip trip{false, 0, 0, 0, 0};
+    trip.energyCost = outpost.distance * uav.energyPerKm * 2; // Round trip
+    if (trip.energyCost > uav.totalEnergy)
+        return trip;
+
+    double travelTime = outpost.distance / uav.speed;
+    trip.depart = max(readyTime, outpost.windowStart - travelTime); // Don't arrive before the window opens
+    trip.arrive = trip.depart + travelTime;
+    if (trip.arrive > outpost.windowEnd)
+        return trip;
+
+    trip.ret = trip.arrive + travelTime;
+    trip.feasible = true;
+    return trip;
+}
+
+// Buffered writer carried over from v9 (no per-record flush, to_chars numbers)
+class OutputBuffer
+{
+public:
+    explicit OutputBuffer(FILE *out) : out(out), buffer(1 << 16), pos(0) {}
+    ~OutputBuffer() { flush(); }
+
+    void put(const char *data, size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+        if (n > buffer.size())
+        {
+            fwrite(data, 1, n, out);
+            return;
+        }
+        memcpy(buffer.data() + pos, data, n);
+        pos += n;
+    }
+
+    void put(const char *text) { put(text, strlen(text)); }
+
+    void putInt(long long value)
+    {
+        reserve(32);
+        auto result = to_chars(buffer.data() + pos, buffer.data() + buffer.size(), value);
+        pos = result.ptr - buffer.data();
+    }
+
+    void putDouble(double value, int precision = 0)
+    {
+        reserve(32);
+        char *first = buffer.data() + pos;
+        char *last = buffer.data() + buffer.size();
+        auto result = precision > 0 ? to_chars(first, last, value, chars_format::general, precision)
+                                    : to_chars(first, last, value);
+        pos = result.ptr - buffer.data();
+    }
+
+    void reserve(size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+    }
+
+    void flush()
+    {
+        if (pos > 0)
+            fwrite(buffer.data(), 1, pos, out);
+        pos = 0;
+        fflush(out);
+    }
+
+private:
+    FILE *out;
+    vector<char> buffer;
+    size_t pos;
+};
+
+class ResultSink
+{
+public:
+    explicit ResultSink(FILE *out) : buf(out) {}
+    virtual ~ResultSink() = default;
+    virtual void begin() {}
+    virtual void write(const DispatchRecord &record) = 0;
+    virtual void end() { buf.flush(); }
+
+protected:
+    OutputBuffer buf;
+};
+
+class TextSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("\nBest UAV Allocation:\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId < 0)
+        {
+            buf.put("⚠️ Warning: Outpost ");
+            buf.putInt(r.outpostId);
+            buf.put(" could not be served within its delivery window.\n");
+            return;
+        }
+        buf.put("UAV ");
+        buf.putInt(r.uavId);
+        buf.put(" assigned to Outpost ");
+        buf.putInt(r.outpostId);
+        buf.put(" | Distance: ");
+        buf.putDouble(r.distance, 6);
+        buf.put(" | Energy Cost: ");
+        buf.putDouble(r.energyCost, 6);
+        buf.put(" | Depart: ");
+        buf.putDouble(r.depart, 6);
+        buf.put(" | Arrive: ");
+        buf.putDouble(r.arrive, 6);
+        buf.put(" | Available Again At: ");
+        buf.putDouble(r.availableAgain, 6);
+        buf.put("\n");
+    }
+};
+
+class CsvSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("uav_id,outpost_id,distance,energy_cost,depart,arrive,available_again\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId >= 0)
+            buf.putInt(r.uavId);
+        buf.put(",");
+        buf.putInt(r.outpostId);
+        buf.put(",");
+        buf.putDouble(r.distance);
+        if (r.uavId >= 0)
+        {
+            buf.put(",");
+            buf.putDouble(r.energyCost);
+            buf.put(",");
+            buf.putDouble(r.depart);
+            buf.put(",");
+            buf.putDouble(r.arrive);
+            buf.put(",");
+            buf.putDouble(r.availableAgain);
+            buf.put("\n");
+        }
+        else
+        {
+            buf.put(",,,,\n");
+        }
+    }
+};
+
+void printSummary(FILE *out, const RunSummary &summary)
+{
+    double utilization = summary.makespan > 0 ? summary.busyTime / (summary.fleetSize * summary.makespan) : 0;
+    double throughput = summary.makespan > 0 ? summary.assigned / summary.makespan : 0;
+
+    OutputBuffer buf(out);
+    buf.put("Assigned: ");
+    buf.putInt(summary.assigned);
+    buf.put(" | Missed: ");
+    buf.putInt(summary.missed);
+    buf.put(" | Total Energy: ");
+    buf.putDouble(summary.totalEnergy, 6);
+    buf.put(" | Makespan: ");
+    buf.putDouble(summary.makespan, 6);
+    buf.put(" | Fleet Utilization: ");
+    buf.putDouble(utilization * 100, 4);
+    buf.put("% | Deliveries/Hour: ");
+    buf.putDouble(throughput, 6);
+    buf.put("\n");
+}
+
+// Rolling-horizon dispatcher. Decisions happen when a UAV becomes free; the
+// choice for that UAV is made by simulating the next `lookahead` decisions
+// over the `branch` best candidates each and committing only the first one.
+class Dispatcher
+{
+public:
+    Dispatcher(vector<UAV> &uavs, vector<Outpost> &outposts, int lookahead, int branch)
+        : uavs(uavs), outposts(outposts), served(outposts.size(), false), lookahead(lookahead), branch(branch)
+    {
+        // Highest priority first, tighter deadline breaks ties
+        sort(outposts.begin(), outposts.end(), [](const Outpost &a, const Outpost &b)
+             { return a.priority != b.priority ? a.priority > b.priority : a.windowEnd < b.windowEnd; });
+        for (int i = 0; i < (int)uavs.size(); i++)
+            events.push({uavs[i].availableTime, i});
+    }
+
+    void run(ResultSink *sink, RunSummary &summary)
+    {
+        while (!events.empty() && remaining() > 0)
+        {
+            Task event = events.top();
+            events.pop();
+
+            int chosen = chooseOutpost(event);
+            if (chosen < 0)
+                continue; // Nothing left this UAV can ever serve: it stays at base
+
+            UAV &uav = uavs[event.uavIndex];
+            const Outpost &outpost = outposts[chosen];
+            Trip trip = planTrip(uav, outpost, event.time);
+
+            served[chosen] = true;
+            servedCount++;
+            uav.availableTime = trip.ret;
+            uav.busyTime += trip.ret - trip.depart;
+            events.push({trip.ret, event.uavIndex});
+
+            summary.assigned++;
+            summary.totalEnergy += trip.energyCost;
+            summary.makespan = max(summary.makespan, trip.ret);
+            summary.busyTime += trip.ret - trip.depart;
+            if (sink)
+                sink->write({uav.id, outpost.id, outpost.distance, trip.energyCost, trip.depart, trip.arrive, trip.ret});
+        }
+
+        for (size_t i = 0; i < outposts.size(); i++)
+        {
+            if (!served[i])
+            {
+                summary.missed++;
+                if (sink)
+                    sink->write({-1, outposts[i].id, outposts[i].distance, 0, 0, 0, 0});
+            }
+        }
+    }
+
+private:
+    // Score of a simulated horizon: more priority served first, then earlier
+    // completion of the horizon, then less energy
+    struct Score
+    {
+        long long priority = 0;
+        double makespan = 0;
+        double energy = 0;
+
+        bool betterThan(const Score &other) const
+        {
+            if (priority != other.priority)
+                return priority > other.priority;
+            if (makespan != other.makespan)
+                return makespan < other.makespan;
+            return energy < other.energy;
+        }
+    };
+
+    vector<UAV> &uavs;
+    vector<Outpost> &outposts;
+    vector<bool> served;
+    size_t servedCount = 0;
+    size_t firstPending = 0; // Every outpost before this index is served
+    int lookahead, branch;
+    priority_queue<Task, vector<Task>, greater<Task>> events;
+
+    size_t remaining() const { return outposts.size() - servedCount; }
+
+    // Up to `limit` feasible pending outposts for this UAV, best priority first.
+    // `reserved` holds outposts already taken earlier in the simulated horizon.
+    vector<int> candidates(int uavIndex, double readyTime, const vector<int> &reserved, int limit, bool exhaustive)
+    {
+        while (firstPending < outposts.size() && served[firstPending])
+            firstPending++;
+
+        vector<int> result;
+        size_t scanned = 0;
+        for (size_t i = firstPending; i < outposts.size() && (int)result.size() < limit; i++)
+        {
+            if (served[i] || find(reserved.begin(), reserved.end(), (int)i) != reserved.end())
+                continue;
+            if (!exhaustive && ++scanned > SCAN_LIMIT)
+                break;
+            if (planTrip(uavs[uavIndex], outposts[i], readyTime).feasible)
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    // Depth-first search over the next decisions. `frontier` holds the UAV
+    // events the simulation may consume (the earliest real events plus the
+    // simulated returns); it is small, so linear scans are fine here.
+    void search(vector<Task> &frontier, vector<int> &reserved, int depth, Score current, Score &best, bool &found)
+    {
+        if (depth == lookahead || frontier.empty())
+        {
+            if (!found || current.betterThan(best))
+            {
+                best = current;
+                found = true;
+            }
+            return;
+        }
+
+        size_t next = 0;
+        for (size_t i = 1; i < frontier.size(); i++)
+            if (frontier[i].time < frontier[next].time)
+                next = i;
+        Task event = frontier[next];
+        frontier.erase(frontier.begin() + next);
+
+        vector<int> options = candidates(event.uavIndex, event.time, reserved, branch, false);
+        if (options.empty())
+        {
+            search(frontier, reserved, depth + 1, current, best, found);
+        }
+        for (int outpostIndex : options)
+        {
+            Trip trip = planTrip(uavs[event.uavIndex], outposts[outpostIndex], event.time);
+            Score extended = current;
+            extended.priority += outposts[outpostIndex].priority;
+            extended.makespan = max(extended.makespan, trip.ret);
+            extended.energy += trip.energyCost;
+
+            reserved.push_back(outpostIndex);
+            frontier.push_back({trip.ret, event.uavIndex});
+            search(frontier, reserved, depth + 1, extended, best, found);
+            frontier.pop_back();
+            reserved.pop_back();
+        }
+
+        frontier.insert(frontier.begin() + next, event);
+    }
+
+    int chooseOutpost(const Task &event)
+    {
+        vector<int> none;
+        vector<int> options = candidates(event.uavIndex, event.time, none, branch, false);
+        if (options.empty())
+        {
+            // Nothing near the front of the queue fits; fall back to a full scan
+            options = candidates(event.uavIndex, event.time, none, 1, true);
+            return options.empty() ? -1 : options[0];
+        }
+        if (options.size() == 1 || lookahead <= 1)
+            return options[0];
+
+        // Earliest upcoming events of other UAVs that the horizon can reach
+        vector<Task> others;
+        while (!events.empty() && (int)others.size() < lookahead)
+        {
+            others.push_back(events.top());
+            events.pop();
+        }
+
+        int bestChoice = options[0];
+        Score bestScore;
+        bool haveBest = false;
+        for (int outpostIndex : options)
+        {
+            Trip trip = planTrip(uavs[event.uavIndex], outposts[outpostIndex], event.time);
+            Score start;
+            start.priority = outposts[outpostIndex].priority;
+            start.makespan = trip.ret;
+            start.energy = trip.energyCost;
+
+            vector<Task> frontier = others;
+            frontier.push_back({trip.ret, event.uavIndex});
+            vector<int> reserved{outpostIndex};
+
+            Score best;
+            bool found = false;
+            search(frontier, reserved, 1, start, best, found);
+            if (!haveBest || best.betterThan(bestScore))
+            {
+                bestScore = best;
+                bestChoice = outpostIndex;
+                haveBest = true;
+            }
+        }
+
+        for (const Task &task : others)
+            events.push(task);
+        return bestChoice;
+    }
+};
+
+int main(int argc, char **argv)
+{
+    // Options: --lookahead=K  --branch=B  --format=text|csv  --output=<file>  --quiet
+    int lookahead = DEFAULT_LOOKAHEAD;
+    int branch = DEFAULT_BRANCH;
+    string format = "text";
+    string outputPath;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--lookahead=", 0) == 0)
+            lookahead = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--branch=", 0) == 0)
+            branch = max(1, stoi(arg.substr(9)));
+        else if (arg.rfind("--format=", 0) == 0)
+            format = arg.substr(9);
+        else if (arg.rfind("--output=", 0) == 0)
+            outputPath = arg.substr(9);
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (format != "text" && format != "csv")
+    {
+        cerr << "Unknown format: " << format << " (expected text or csv)\n";
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (!outputPath.empty())
+    {
+        out = fopen(outputPath.c_str(), "w");
+        if (!out)
+        {
+            cerr << "Cannot open output file: " << outputPath << "\n";
+            return 1;
+        }
+    }
+
+    unique_ptr<ResultSink> sink;
+    if (!quiet)
+    {
+        if (format == "csv")
+            sink = make_unique<CsvSink>(out);
+        else
+            sink = make_unique<TextSink>(out);
+    }
+
+    bool interactive = format == "text" && !quiet;
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    if (interactive)
+        cout << "Enter number of outposts: " << flush;
+    cin >> numOutposts;
+    if (interactive)
+        cout << "Enter number of UAVs: " << flush;
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    if (interactive)
+        cout << "Enter UAV details (ID, weight capacity, energy/km, total energy, speed):\n" << flush;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy >> uavs[i].speed;
+        if (uavs[i].speed <= 0)
+            uavs[i].speed = 10.0; // v8 default speed
+        uavs[i].availableTime = 0;
+        uavs[i].busyTime = 0;
+    }
+
+    double baseX, baseY;
+    if (interactive)
+        cout << "Enter Base Station coordinates (x y): " << flush;
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    if (interactive)
+        cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5, window start, window end):\n" << flush;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        Outpost &o = outposts[i];
+        cin >> o.id >> o.medicine >> o.food >> o.weapons >> o.x >> o.y >> o.priority >> o.windowStart >> o.windowEnd;
+        if (o.windowEnd <= 0)
+            o.windowEnd = 1e18; // 0 (or negative) end means "no deadline"
+        o.distance = calculateDistance(baseX, baseY, o.x, o.y);
+    }
+
+    if (sink)
+        sink->begin();
+
+    RunSummary summary;
+    summary.fleetSize = numUAVs;
+    Dispatcher dispatcher(uavs, outposts, lookahead, branch);
+    dispatcher.run(sink.get(), summary);
+
+    if (sink)
+        sink->end();
+
+    FILE *summaryOut = (quiet || format == "text" || out != stdout) ? stdout : stderr;
+    printSummary(summaryOut, summary);
+
+    sink.reset();
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,657 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <map>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <limits>
+
+using namespace std;
+
+const double INF = numeric_limits<double>::infinity();
+
+// CC-CV charger: full rate up to this share of the battery, then tapering
+const double CCCV_KNEE = 0.8;
+const double CCCV_TAIL_RATE = 0.1; // Rate at 100% as a fraction of the full rate
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy; // Battery capacity
+    double speed;
+    double availableTime; // Time when UAV is back at base
+    double charge;        // State of charge at availableTime
+    int type;             // Index into the fleet types (same energy/km and battery)
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+struct DispatchRecord
+{
+    int uavId; // -1 when the outpost could not be reached
+    int outpostId;
+    double distance;
+    double energyCost;
+    double depart;
+    double chargeWait; // Time spent on the charger before departure
+    double chargeAfter;
+    double availableAgain;
+};
+
+struct RunSummary
+{
+    long long assigned = 0;
+    long long unreachable = 0;
+    double totalEnergy = 0;
+    double makespan = 0;
+    double chargeWait = 0;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Recharge model at the base. chargeTime(level) is the time to charge an empty
+// battery of the given capacity up to `level`; it is monotone, so the time to go
+// from s to e is chargeTime(e) - chargeTime(s).
+struct Charger
+{
+    enum Model
+    {
+        INSTANT, // v8 behaviour: back at base means fully charged
+        LINEAR,
+        CCCV
+    };
+    Model model = LINEAR;
+    double rate = 50; // Energy units per time unit
+
+    double chargeTime(double level, double capacity) const
+    {
+        if (model == INSTANT)
+            return 0;
+        if (model == LINEAR || level <= CCCV_KNEE * capacity)
+            return level / rate;
+
+        // Rate drops linearly from `rate` at the knee to CCCV_TAIL_RATE * rate at full
+        double tail = (1 - CCCV_KNEE) * capacity;
+        double slope = (1 - CCCV_TAIL_RATE) / tail;
+        double over = min(level, capacity) - CCCV_KNEE * capacity;
+        return CCCV_KNEE * capacity / rate - log(1 - slope * over) / (slope * rate);
+    }
+};
+
+// Treap of the UAVs of one fleet type keyed by state of charge. For a trip
+// needing energy E, a UAV with charge s >= E is ready at its return time a,
+// and one with s < E at c + chargeTime(E) where c = a - chargeTime(s). Each
+// node keeps the subtree minimum of a and of c, so "earliest ready UAV for E"
+// is one root-to-leaf walk: O(log n) per query and update.
+class ChargeIndex
+{
+public:
+    struct Best
+    {
+        double time = INF;
+        int uav = -1;
+    };
+
+    void insert(int uav, double charge, double a, double c)
+    {
+        if ((int)nodes.size() <= uav)
+            nodes.resize(uav + 1);
+        nodes[uav] = {charge, a, c, {a, uav}, {c, uav}, (unsigned)rng(), -1, -1};
+        root = insertAt(root, uav);
+    }
+
+    void erase(int uav)
+    {
+        root = eraseAt(root, uav);
+    }
+
+    // Earliest time any UAV in this index holds `required` energy
+    Best earliest(double required, double requiredChargeTime) const
+    {
+        Best ready, charging;
+        int node = root;
+        while (node != -1)
+        {
+            const Node &n = nodes[node];
+            if (less(n, required))
+            {
+                // n and its left subtree are below `required`
+                take(charging, n.c, node);
+                if (n.left != -1)
+                    take(charging, nodes[n.left].minC);
+                node = n.right;
+            }
+            else
+            {
+                // n and its right subtree already hold enough charge
+                take(ready, n.a, node);
+                if (n.right != -1)
+                    take(ready, nodes[n.right].minA);
+                node = n.left;
+            }
+        }
+        if (charging.uav != -1)
+            charging.time += requiredChargeTime;
+        take(ready, charging.time, charging.uav);
+        return ready;
+    }
+
+private:
+    struct Node
+    {
+        double charge, a, c;
+        pair<double, int> minA, minC;
+        unsigned priority;
+        int left, right;
+    };
+
+    vector<Node> nodes;
+    int root = -1;
+    mt19937 rng{12345};
+
+    static bool less(const Node &n, double required) { return n.charge < required; }
+
+    // Ties go to the lowest UAV index so results do not depend on tree shape
+    static void take(Best &best, double time, int uav)
+    {
+        if (time < best.time || (time == best.time && uav < best.uav))
+            best = {time, uav};
+    }
+
+    static void take(Best &best, const pair<double, int> &candidate) { take(best, candidate.first, candidate.second); }
+
+    bool keyLess(int x, int y) const
+    {
+        return nodes[x].charge != nodes[y].charge ? nodes[x].charge < nodes[y].charge : x < y;
+    }
+
+    void pull(int x)
+    {
+        Node &n = nodes[x];
+        n.minA = {n.a, x};
+        n.minC = {n.c, x};
+        for (int child : {n.left, n.right})
+        {
+            if (child != -1)
+            {
+                n.minA = min(n.minA, nodes[child].minA);
+                n.minC = min(n.minC, nodes[child].minC);
+            }
+        }
+    }
+
+    int rotateRight(int x)
+    {
+        int y = nodes[x].left;
+        nodes[x].left = nodes[y].right;
+        nodes[y].right = x;
+        pull(x);
+        pull(y);
+        return y;
+    }
+
+    int rotateLeft(int x)
+    {
+        int y = nodes[x].right;
+        nodes[x].right = nodes[y].left;
+        nodes[y].left = x;
+        pull(x);
+        pull(y);
+        return y;
+    }
+
+    int insertAt(int t, int x)
+    {
+        if (t == -1)
+            return x;
+        if (keyLess(x, t))
+        {
+            nodes[t].left = insertAt(nodes[t].left, x);
+            if (nodes[nodes[t].left].priority > nodes[t].priority)
+                return rotateRight(t);
+        }
+        else
+        {
+            nodes[t].right = insertAt(nodes[t].right, x);
+            if (nodes[nodes[t].right].priority > nodes[t].priority)
+                return rotateLeft(t);
+        }
+        pull(t);
+        return t;
+    }
+
+    int merge(int l, int r)
+    {
+        if (l == -1)
+            return r;
+        if (r == -1)
+            return l;
+        if (nodes[l].priority > nodes[r].priority)
+        {
+            nodes[l].right = merge(nodes[l].right, r);
+            pull(l);
+            return l;
+        }
+        nodes[r].left = merge(l, nodes[r].left);
+        pull(r);
+        return r;
+    }
+
+    int eraseAt(int t, int x)
+    {
+        if (t == -1)
+            return -1;
+        if (t == x)
+            return merge(nodes[t].left, nodes[t].right);
+        if (keyLess(x, t))
+            nodes[t].left = eraseAt(nodes[t].left, x);
+        else
+            nodes[t].right = eraseAt(nodes[t].right, x);
+        pull(t);
+        return t;
+    }
+};
+
+// Fleet split into types; one charge index per type
+class BatteryScheduler
+{
+public:
+    BatteryScheduler(vector<UAV> &uavs, const Charger &charger, double reserve)
+        : uavs(uavs), charger(charger), reserve(reserve)
+    {
+        map<pair<double, double>, int> typeOf;
+        for (int i = 0; i < (int)uavs.size(); i++)
+        {
+            auto key = make_pair(uavs[i].energyPerKm, uavs[i].totalEnergy);
+            auto it = typeOf.find(key);
+            if (it == typeOf.end())
+            {
+                it = typeOf.emplace(key, (int)types.size()).first;
+                types.push_back({key.first, key.second, ChargeIndex()});
+            }
+            uavs[i].type = it->second;
+            add(i);
+        }
+    }
+
+    // Pick the UAV that is earliest ready for a round trip of `distance`
+    // (lowest energy on ties), fly it and update its battery state
+    bool dispatch(double distance, DispatchRecord &record)
+    {
+        ChargeIndex::Best best;
+        double bestEnergy = INF;
+        for (Type &type : types)
+        {
+            double energy = 2 * distance * type.energyPerKm;
+            double required = energy + reserve * type.capacity;
+            if (required > type.capacity)
+                continue;
+            ChargeIndex::Best candidate = type.index.earliest(required, charger.chargeTime(required, type.capacity));
+            if (candidate.uav != -1 && (candidate.time < best.time || (candidate.time == best.time && energy < bestEnergy)))
+            {
+                best = candidate;
+                bestEnergy = energy;
+            }
+        }
+        if (best.uav == -1)
+            return false;
+
+        UAV &uav = uavs[best.uav];
+        types[uav.type].index.erase(best.uav);
+
+        double required = bestEnergy + reserve * uav.totalEnergy;
+        double chargeAtDeparture = max(uav.charge, required);
+        double travelTime = distance / uav.speed;
+
+        record.uavId = uav.id;
+        record.energyCost = bestEnergy;
+        record.depart = best.time;
+        record.chargeWait = best.time - uav.availableTime;
+
+        uav.charge = chargeAtDeparture - bestEnergy;
+        uav.availableTime = best.time + 2 * travelTime;
+        if (charger.model == Charger::INSTANT)
+            uav.charge = uav.totalEnergy;
+        record.chargeAfter = uav.charge;
+        record.availableAgain = uav.availableTime;
+
+        add(best.uav);
+        return true;
+    }
+
+private:
+    struct Type
+    {
+        double energyPerKm;
+        double capacity;
+        ChargeIndex index;
+    };
+
+    vector<UAV> &uavs;
+    const Charger &charger;
+    double reserve; // Share of the battery that must remain after a trip
+    vector<Type> types;
+
+    void add(int i)
+    {
+        const UAV &uav = uavs[i];
+        double c = uav.availableTime - charger.chargeTime(uav.charge, uav.totalEnergy);
+        types[uav.type].index.insert(i, uav.charge, uav.availableTime, c);
+    }
+};
+
+// Buffered writer carried over from v9 (no per-record flush, to_chars numbers)
+class OutputBuffer
+{
+public:
+    explicit OutputBuffer(FILE *out) : out(out), buffer(1 << 16), pos(0) {}
+    ~OutputBuffer() { flush(); }
+
+    void put(const char *data, size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+        if (n > buffer.size())
+        {
+            fwrite(data, 1, n, out);
+            return;
+        }
+        memcpy(buffer.data() + pos, data, n);
+        pos += n;
+    }
+
+    void put(const char *text) { put(text, strlen(text)); }
+
+    void putInt(long long value)
+    {
+        reserve(32);
+        auto result = to_chars(buffer.data() + pos, buffer.data() + buffer.size(), value);
+        pos = result.ptr - buffer.data();
+    }
+
+    void putDouble(double value, int precision = 0)
+    {
+        reserve(32);
+        char *first = buffer.data() + pos;
+        char *last = buffer.data() + buffer.size();
+        auto result = precision > 0 ? to_chars(first, last, value, chars_format::general, precision)
+                                    : to_chars(first, last, value);
+        pos = result.ptr - buffer.data();
+    }
+
+    void reserve(size_t n)
+    {
+        if (n > buffer.size() - pos)
+            flush();
+    }
+
+    void flush()
+    {
+        if (pos > 0)
+            fwrite(buffer.data(), 1, pos, out);
+        pos = 0;
+        fflush(out);
+    }
+
+private:
+    FILE *out;
+    vector<char> buffer;
+    size_t pos;
+};
+
+class ResultSink
+{
+public:
+    explicit ResultSink(FILE *out) : buf(out) {}
+    virtual ~ResultSink() = default;
+    virtual void begin() {}
+    virtual void write(const DispatchRecord &record) = 0;
+    virtual void end() { buf.flush(); }
+
+protected:
+    OutputBuffer buf;
+};
+
+class TextSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("\nBest UAV Allocation:\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId < 0)
+        {
+            buf.put("⚠️ Warning: Outpost ");
+            buf.putInt(r.outpostId);
+            buf.put(" could not be reached due to UAV constraints.\n");
+            return;
+        }
+        buf.put("UAV ");
+        buf.putInt(r.uavId);
+        buf.put(" assigned to Outpost ");
+        buf.putInt(r.outpostId);
+        buf.put(" | Distance: ");
+        buf.putDouble(r.distance, 6);
+        buf.put(" | Energy Cost: ");
+        buf.putDouble(r.energyCost, 6);
+        buf.put(" | Charge Wait: ");
+        buf.putDouble(r.chargeWait, 6);
+        buf.put(" | Depart: ");
+        buf.putDouble(r.depart, 6);
+        buf.put(" | Battery Left: ");
+        buf.putDouble(r.chargeAfter, 6);
+        buf.put(" | Available Again At: ");
+        buf.putDouble(r.availableAgain, 6);
+        buf.put("\n");
+    }
+};
+
+class CsvSink : public ResultSink
+{
+public:
+    using ResultSink::ResultSink;
+
+    void begin() override { buf.put("uav_id,outpost_id,distance,energy_cost,charge_wait,depart,charge_after,available_again\n"); }
+
+    void write(const DispatchRecord &r) override
+    {
+        if (r.uavId >= 0)
+            buf.putInt(r.uavId);
+        buf.put(",");
+        buf.putInt(r.outpostId);
+        buf.put(",");
+        buf.putDouble(r.distance);
+        if (r.uavId < 0)
+        {
+            buf.put(",,,,,\n");
+            return;
+        }
+        for (double value : {r.energyCost, r.chargeWait, r.depart, r.chargeAfter, r.availableAgain})
+        {
+            buf.put(",");
+            buf.putDouble(value);
+        }
+        buf.put("\n");
+    }
+};
+
+void printSummary(FILE *out, const RunSummary &summary)
+{
+    OutputBuffer buf(out);
+    buf.put("Assigned: ");
+    buf.putInt(summary.assigned);
+    buf.put(" | Unreachable: ");
+    buf.putInt(summary.unreachable);
+    buf.put(" | Total Energy: ");
+    buf.putDouble(summary.totalEnergy, 6);
+    buf.put(" | Makespan: ");
+    buf.putDouble(summary.makespan, 6);
+    buf.put(" | Total Charge Wait: ");
+    buf.putDouble(summary.chargeWait, 6);
+    buf.put(" | Deliveries/Hour: ");
+    buf.putDouble(summary.makespan > 0 ? summary.assigned / summary.makespan : 0, 6);
+    buf.put("\n");
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --charger=instant|linear|cccv  --charge-rate=R  --reserve=F
+    //          --format=text|csv  --output=<file>  --quiet
+    Charger charger;
+    double reserve = 0;
+    string format = "text";
+    string outputPath;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--charger=instant")
+            charger.model = Charger::INSTANT;
+        else if (arg == "--charger=linear")
+            charger.model = Charger::LINEAR;
+        else if (arg == "--charger=cccv")
+            charger.model = Charger::CCCV;
+        else if (arg.rfind("--charge-rate=", 0) == 0)
+            charger.rate = stod(arg.substr(14));
+        else if (arg.rfind("--reserve=", 0) == 0)
+            reserve = stod(arg.substr(10));
+        else if (arg.rfind("--format=", 0) == 0)
+            format = arg.substr(9);
+        else if (arg.rfind("--output=", 0) == 0)
+            outputPath = arg.substr(9);
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (format != "text" && format != "csv")
+    {
+        cerr << "Unknown format: " << format << " (expected text or csv)\n";
+        return 1;
+    }
+    if (charger.rate <= 0 || reserve < 0 || reserve >= 1)
+    {
+        cerr << "Charge rate must be positive and reserve in [0, 1)\n";
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (!outputPath.empty())
+    {
+        out = fopen(outputPath.c_str(), "w");
+        if (!out)
+        {
+            cerr << "Cannot open output file: " << outputPath << "\n";
+            return 1;
+        }
+    }
+
+    unique_ptr<ResultSink> sink;
+    if (!quiet)
+    {
+        if (format == "csv")
+            sink = make_unique<CsvSink>(out);
+        else
+            sink = make_unique<TextSink>(out);
+    }
+
+    bool interactive = format == "text" && !quiet;
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    if (interactive)
+        cout << "Enter number of outposts: " << flush;
+    cin >> numOutposts;
+    if (interactive)
+        cout << "Enter number of UAVs: " << flush;
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    if (interactive)
+        cout << "Enter UAV details (ID, weight capacity, energy/km, total energy, speed):\n" << flush;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy >> uavs[i].speed;
+        if (uavs[i].speed <= 0)
+            uavs[i].speed = 10.0; // v8 default speed
+        uavs[i].availableTime = 0;
+        uavs[i].charge = uavs[i].totalEnergy; // Every UAV starts fully charged
+    }
+
+    double baseX, baseY;
+    if (interactive)
+        cout << "Enter Base Station coordinates (x y): " << flush;
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    if (interactive)
+        cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n" << flush;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    // Sort outposts by priority (descending)
+    stable_sort(outposts.begin(), outposts.end(), [](const Outpost &a, const Outpost &b)
+                { return a.priority > b.priority; });
+
+    BatteryScheduler scheduler(uavs, charger, reserve);
+
+    if (sink)
+        sink->begin();
+
+    RunSummary summary;
+    for (const auto &outpost : outposts)
+    {
+        double distance = calculateDistance(baseX, baseY, outpost.x, outpost.y);
+        DispatchRecord record{-1, outpost.id, distance, 0, 0, 0, 0, 0};
+        if (scheduler.dispatch(distance, record))
+        {
+            summary.assigned++;
+            summary.totalEnergy += record.energyCost;
+            summary.chargeWait += record.chargeWait;
+            summary.makespan = max(summary.makespan, record.availableAgain);
+        }
+        else
+        {
+            summary.unreachable++;
+        }
+
+        if (sink)
+            sink->write(record);
+    }
+
+    if (sink)
+        sink->end();
+
+    FILE *summaryOut = (quiet || format == "text" || out != stdout) ? stdout : stderr;
+    printSummary(summaryOut, summary);
+
+    sink.reset();
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,625 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <string>
+#include <limits>
+
+using namespace std;
+
+// ALNS defaults (overridable from the command line)
+const int DEFAULT_ROUNDS = 2000;
+const int DEFAULT_PROPOSALS = 16;      // Destroy/repair proposals evaluated per round
+const int DEFAULT_REMOVE = 24;         // Outposts touched by one destroy
+const double UNSERVED_PENALTY = 100.0; // Cost per priority level of an unserved outpost
+const double INFEASIBLE = 1e9;         // Cost of an out-of-range pair in the exact repair
+
+// Adaptive weights: scores for a new best / an improvement / no gain
+const double SCORE_BEST = 33, SCORE_BETTER = 9, SCORE_NONE = 1;
+const double REACTION = 0.2;
+const int SEGMENT = 50; // Rounds between weight updates
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+bool compareByPriority(const Outpost &a, const Outpost &b)
+{
+    return a.priority > b.priority; // Sort in descending order of priority
+}
+
+// Shared read-only view of the instance
+struct Instance
+{
+    const vector<UAV> &uavs;
+    const vector<Outpost> &outposts;
+    vector<double> distance; // Base to outpost
+
+    double energy(int u, int o) const { return distance[o] * uavs[u].energyPerKm; }
+    bool feasible(int u, int o) const { return energy(u, o) <= uavs[u].totalEnergy; }
+    double unservedCost(int o) const { return UNSERVED_PENALTY * outposts[o].priority; }
+};
+
+// Uniform grid over outposts for "k nearest outposts" queries
+class SpatialGrid
+{
+public:
+    SpatialGrid(const vector<Outpost> &outposts) : outposts(outposts)
+    {
+        minX = minY = numeric_limits<double>::max();
+        double maxX = -minX, maxY = -minY;
+        for (const auto &o : outposts)
+        {
+            minX = min(minX, o.x), maxX = max(maxX, o.x);
+            minY = min(minY, o.y), maxY = max(maxY, o.y);
+        }
+        cells = max(1, (int)sqrt(outposts.size() / 4.0)); // About 4 outposts per cell
+        cellW = max((maxX - minX) / cells, 1e-9);
+        cellH = max((maxY - minY) / cells, 1e-9);
+
+        start.assign(cells * cells + 1, 0);
+        for (const auto &o : outposts)
+            start[cellOf(o.x, o.y) + 1]++;
+        partial_sum(start.begin(), start.end(), start.begin());
+        items.resize(outposts.size());
+        vector<int> fill(start.begin(), start.end() - 1);
+        for (int i = 0; i < (int)outposts.size(); i++)
+            items[fill[cellOf(outposts[i].x, outposts[i].y)]++] = i;
+    }
+
+    // The k outposts closest to outpost `center` (including itself)
+    vector<int> nearest(int center, int k) const
+    {
+        int cx = cellX(outposts[center].x), cy = cellY(outposts[center].y);
+        vector<pair<double, int>> found;
+        for (int ring = 0; ring < cells; ring++)
+        {
+            for (int y = cy - ring; y <= cy + ring; y++)
+            {
+                for (int x = cx - ring; x <= cx + ring; x++)
+                {
+                    if (x < 0 || y < 0 || x >= cells || y >= cells || (abs(x - cx) != ring && abs(y - cy) != ring))
+                        continue;
+                    int cell = y * cells + x;
+                    for (int i = start[cell]; i < start[cell + 1]; i++)
+                    {
+                        int o = items[i];
+                        found.push_back({calculateDistance(outposts[center].x, outposts[center].y, outposts[o].x, outposts[o].y), o});
+                    }
+                }
+            }
+            // Everything within `ring` cell widths is now known
+            if ((int)found.size() >= k && ring > 0)
+                break;
+        }
+        size_t take = min(found.size(), (size_t)k);
+        partial_sort(found.begin(), found.begin() + take, found.end());
+        vector<int> result(take);
+        for (size_t i = 0; i < take; i++)
+            result[i] = found[i].second;
+        return result;
+    }
+
+private:
+    const vector<Outpost> &outposts;
+    double minX, minY, cellW, cellH;
+    int cells;
+    vector<int> start, items;
+
+    int cellX(double x) const { return min(cells - 1, max(0, (int)((x - minX) / cellW))); }
+    int cellY(double y) const { return min(cells - 1, max(0, (int)((y - minY) / cellH))); }
+    int cellOf(double x, double y) const { return cellY(y) * cells + cellX(x); }
+};
+
+// Current allocation with O(1) incremental cost updates
+struct Solution
+{
+    vector<int> uavOf;     // Per outpost, -1 if unserved
+    vector<int> outpostOf; // Per UAV, -1 if idle
+    vector<int> idle;      // Idle UAVs
+    vector<int> idlePos;   // Position of a UAV in `idle`, -1 if busy
+    double cost = 0;
+
+    Solution(const Instance &inst) : uavOf(inst.outposts.size(), -1), outpostOf(inst.uavs.size(), -1), idlePos(inst.uavs.size())
+    {
+        for (int u = 0; u < (int)inst.uavs.size(); u++)
+        {
+            idlePos[u] = idle.size();
+            idle.push_back(u);
+        }
+        for (int o = 0; o < (int)inst.outposts.size(); o++)
+            cost += inst.unservedCost(o);
+    }
+
+    double costOf(const Instance &inst, int o, int u) const
+    {
+        return u < 0 ? inst.unservedCost(o) : inst.energy(u, o);
+    }
+
+    void assign(const Instance &inst, int o, int u)
+    {
+        int old = uavOf[o];
+        if (old == u)
+            return;
+        cost += costOf(inst, o, u) - costOf(inst, o, old);
+        if (old >= 0)
+        {
+            outpostOf[old] = -1;
+            idlePos[old] = idle.size();
+            idle.push_back(old);
+        }
+        if (u >= 0)
+        {
+            // A UAV serves one outpost, so release whatever it had before
+            if (outpostOf[u] >= 0)
+            {
+                int previous = outpostOf[u];
+                uavOf[previous] = -1;
+                cost += inst.unservedCost(previous) - inst.energy(u, previous);
+            }
+            else
+            {
+                int last = idle.back();
+                idle[idlePos[u]] = last;
+                idlePos[last] = idlePos[u];
+                idle.pop_back();
+            }
+            idlePos[u] = -1;
+            outpostOf[u] = o;
+        }
+        uavOf[o] = u;
+    }
+};
+
+// v7 rule on the whole instance: priority order, first UAV with enough energy
+Solution greedyAllocation(const Instance &inst, const vector<int> &byPriority)
+{
+    Solution s(inst);
+    for (int o : byPriority)
+    {
+        if (s.idle.empty())
+            break;
+        for (int u = 0; u < (int)inst.uavs.size(); u++)
+        {
+            if (s.outpostOf[u] < 0 && inst.feasible(u, o))
+            {
+                s.assign(inst, o, u);
+                break;
+            }
+        }
+    }
+    return s;
+}
+
+// Minimum-cost assignment of rows to columns (rows <= columns), O(r^2 c)
+vector<int> hungarian(const vector<vector<double>> &cost)
+{
+    int r = cost.size(), c = cost[0].size();
+    vector<double> u(r + 1), v(c + 1);
+    vector<int> p(c + 1), way(c + 1);
+    for (int i = 1; i <= r; i++)
+    {
+        p[0] = i;
+        int j0 = 0;
+        vector<double> minv(c + 1, numeric_limits<double>::max());
+        vector<bool> used(c + 1, false);
+        do
+        {
+            used[j0] = true;
+            int i0 = p[j0], j1 = 0;
+            double delta = numeric_limits<double>::max();
+            for (int j = 1; j <= c; j++)
+            {
+                if (used[j])
+                    continue;
+                double cur = cost[i0 - 1][j - 1] - u[i0] - v[j];
+                if (cur < minv[j])
+                    minv[j] = cur, way[j] = j0;
+                if (minv[j] < delta)
+                    delta = minv[j], j1 = j;
+            }
+            for (int j = 0; j <= c; j++)
+            {
+                if (used[j])
+                    u[p[j]] += delta, v[j] -= delta;
+                else
+                    minv[j] -= delta;
+            }
+            j0 = j1;
+        } while (p[j0] != 0);
+        do
+        {
+            int j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0);
+    }
+    vector<int> rowToCol(r, -1);
+    for (int j = 1; j <= c; j++)
+        if (p[j] != 0)
+            rowToCol[p[j] - 1] = j - 1;
+    return rowToCol;
+}
+
+enum Destroy
+{
+    CLUSTER,
+    RANDOM,
+    NUM_DESTROY
+};
+enum Repair
+{
+    GREEDY,
+    EXACT,
+    NUM_REPAIR
+};
+
+// One destroy/repair proposal: the new UAV (or -1) of every touched outpost
+struct Proposal
+{
+    int destroy, repair;
+    vector<int> outposts;
+    vector<int> uavs; // UAVs the proposal may use (freed + sampled idle)
+    vector<int> newUAV;
+    double delta = 0;
+};
+
+class ALNS
+{
+public:
+    ALNS(const Instance &inst, Solution &solution, int proposals, int remove, int threads, unsigned seed)
+        : inst(inst), grid(inst.outposts), solution(solution), numProposals(proposals), remove(remove),
+          numThreads(max(1, threads)), weights(NUM_DESTROY * NUM_REPAIR, 1.0), scores(weights.size(), 0),
+          uses(weights.size(), 0), stamp(inst.outposts.size(), -1), uavStamp(inst.uavs.size(), -1), master(seed) {}
+
+    void run(int rounds)
+    {
+        for (int round = 0; round < rounds; round++)
+        {
+            // Draw operators and seeds on one thread so runs are reproducible
+            vector<Proposal> proposals(numProposals);
+            vector<unsigned> seeds(numProposals);
+            for (int i = 0; i < numProposals; i++)
+            {
+                int op = pickOperator();
+                proposals[i].destroy = op / NUM_REPAIR;
+                proposals[i].repair = op % NUM_REPAIR;
+                seeds[i] = master();
+            }
+
+            // Evaluate against the (read-only) current solution in parallel
+            vector<thread> workers;
+            for (int t = 0; t < numThreads; t++)
+            {
+                workers.emplace_back([&, t]
+                                     {
+                    for (int i = t; i < numProposals; i += numThreads)
+                    {
+                        mt19937 rng(seeds[i]);
+                        build(proposals[i], rng);
+                    } });
+            }
+            for (auto &w : workers)
+                w.join();
+
+            // Apply improving proposals best-first, skipping any that overlap
+            sort(proposals.begin(), proposals.end(), [](const Proposal &a, const Proposal &b)
+                 { return a.delta < b.delta; });
+            bool first = true;
+            for (auto &p : proposals)
+            {
+                int op = p.destroy * NUM_REPAIR + p.repair;
+                uses[op]++;
+                if (p.delta >= -1e-9 || conflicts(p, round))
+                {
+                    scores[op] += SCORE_NONE;
+                    continue;
+                }
+                for (size_t k = 0; k < p.outposts.size(); k++)
+                    solution.assign(inst, p.outposts[k], p.newUAV[k]);
+                scores[op] += first ? SCORE_BEST : SCORE_BETTER;
+                first = false;
+                applied++;
+            }
+
+            if ((round + 1) % SEGMENT == 0)
+                updateWeights();
+        }
+    }
+
+    long long appliedMoves() const { return applied; }
+
+private:
+    const Instance &inst;
+    SpatialGrid grid;
+    Solution &solution;
+    int numProposals, remove, numThreads;
+    vector<double> weights, scores;
+    vector<int> uses;
+    vector<int> stamp, uavStamp; // Round that last changed an outpost / UAV
+    mt19937 master;
+    long long applied = 0;
+
+    int pickOperator()
+    {
+        discrete_distribution<int> pick(weights.begin(), weights.end());
+        return pick(master);
+    }
+
+    void updateWeights()
+    {
+        for (size_t i = 0; i < weights.size(); i++)
+        {
+            if (uses[i] > 0)
+                weights[i] = (1 - REACTION) * weights[i] + REACTION * scores[i] / uses[i];
+            weights[i] = max(weights[i], 0.05);
+            scores[i] = 0;
+            uses[i] = 0;
+        }
+    }
+
+    // Claims the proposal's outposts and UAVs for this round; fails if an
+    // earlier proposal of the same round already changed any of them
+    bool conflicts(const Proposal &p, int round)
+    {
+        for (int o : p.outposts)
+            if (stamp[o] == round)
+                return true;
+        for (int u : p.uavs)
+            if (uavStamp[u] == round)
+                return true;
+        // Nothing it reads has changed since evaluation, so its delta is exact
+        for (int o : p.outposts)
+            stamp[o] = round;
+        for (int u : p.uavs)
+            uavStamp[u] = round;
+        return false;
+    }
+
+    // Destroy: pick the outposts to re-decide and the UAVs available to them
+    void destroy(Proposal &p, mt19937 &rng)
+    {
+        const auto &s = solution;
+        int n = inst.outposts.size();
+        uniform_int_distribution<int> anyOutpost(0, n - 1);
+
+        if (p.destroy == CLUSTER)
+        {
+            // Geometric cluster around a random outpost: served and unserved alike
+            p.outposts = grid.nearest(anyOutpost(rng), remove);
+        }
+        else
+        {
+            // Random mix of served outposts (via random UAVs) and random outposts
+            uniform_int_distribution<int> anyUAV(0, inst.uavs.size() - 1);
+            for (int k = 0; k < remove / 2; k++)
+            {
+                int u = anyUAV(rng);
+                if (s.outpostOf[u] >= 0)
+                    p.outposts.push_back(s.outpostOf[u]);
+            }
+            for (int k = remove / 2; k < remove; k++)
+                p.outposts.push_back(anyOutpost(rng));
+            sort(p.outposts.begin(), p.outposts.end());
+            p.outposts.erase(unique(p.outposts.begin(), p.outposts.end()), p.outposts.end());
+        }
+
+        for (int o : p.outposts)
+            if (s.uavOf[o] >= 0)
+                p.uavs.push_back(s.uavOf[o]);
+
+        // A few idle UAVs so the repair can also grow the served set
+        int extra = min((int)s.idle.size(), remove);
+        for (int k = 0; k < extra; k++)
+        {
+            uniform_int_distribution<int> anyIdle(0, s.idle.size() - 1);
+            p.uavs.push_back(s.idle[anyIdle(rng)]);
+        }
+        sort(p.uavs.begin(), p.uavs.end());
+        p.uavs.erase(unique(p.uavs.begin(), p.uavs.end()), p.uavs.end());
+    }
+
+    // Repair: greedy rule from allocateUAVs (priority order, cheapest feasible UAV)
+    void repairGreedy(Proposal &p, mt19937 &rng)
+    {
+        vector<int> order(p.outposts.size());
+        iota(order.begin(), order.end(), 0);
+        shuffle(order.begin(), order.end(), rng); // Random tie-breaking between equal priorities
+        stable_sort(order.begin(), order.end(), [&](int a, int b)
+                    { return inst.outposts[p.outposts[a]].priority > inst.outposts[p.outposts[b]].priority; });
+
+        vector<bool> used(p.uavs.size(), false);
+        p.newUAV.assign(p.outposts.size(), -1);
+        for (int k : order)
+        {
+            int o = p.outposts[k];
+            int best = -1;
+            for (size_t j = 0; j < p.uavs.size(); j++)
+            {
+                if (!used[j] && inst.feasible(p.uavs[j], o) && inst.energy(p.uavs[j], o) < inst.unservedCost(o) &&
+                    (best < 0 || inst.energy(p.uavs[j], o) < inst.energy(p.uavs[best], o)))
+                    best = j;
+            }
+            if (best >= 0)
+            {
+                used[best] = true;
+                p.newUAV[k] = p.uavs[best];
+            }
+        }
+    }
+
+    // Repair: optimal re-assignment of the touched outposts to the available UAVs
+    void repairExact(Proposal &p)
+    {
+        int r = p.outposts.size(), f = p.uavs.size();
+        vector<vector<double>> cost(r, vector<double>(f + r));
+        for (int i = 0; i < r; i++)
+        {
+            int o = p.outposts[i];
+            for (int j = 0; j < f; j++)
+                cost[i][j] = inst.feasible(p.uavs[j], o) ? inst.energy(p.uavs[j], o) : INFEASIBLE;
+            for (int j = f; j < f + r; j++)
+                cost[i][j] = inst.unservedCost(o); // "Leave unserved" columns
+        }
+        vector<int> col = hungarian(cost);
+        p.newUAV.assign(r, -1);
+        for (int i = 0; i < r; i++)
+            if (col[i] >= 0 && col[i] < f)
+                p.newUAV[i] = p.uavs[col[i]];
+    }
+
+    void build(Proposal &p, mt19937 &rng)
+    {
+        destroy(p, rng);
+        if (p.outposts.empty())
+        {
+            p.delta = 0;
+            return;
+        }
+        if (p.repair == GREEDY)
+            repairGreedy(p, rng);
+        else
+            repairExact(p);
+
+        // Incremental cost: p.uavs only holds UAVs freed by the destroy or idle
+        // ones, so no outpost outside the touched set changes
+        p.delta = 0;
+        for (size_t k = 0; k < p.outposts.size(); k++)
+        {
+            int o = p.outposts[k];
+            p.delta += solution.costOf(inst, o, p.newUAV[k]) - solution.costOf(inst, o, solution.uavOf[o]);
+        }
+    }
+};
+
+int main(int argc, char **argv)
+{
+    // Options: --rounds=N  --proposals=P  --remove=Q  --threads=T  --seed=S  --quiet
+    int rounds = DEFAULT_ROUNDS, proposals = DEFAULT_PROPOSALS, remove = DEFAULT_REMOVE;
+    int threads = max(1u, thread::hardware_concurrency());
+    unsigned seed = 0;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--rounds=", 0) == 0)
+            rounds = stoi(arg.substr(9));
+        else if (arg.rfind("--proposals=", 0) == 0)
+            proposals = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--remove=", 0) == 0)
+            remove = max(2, stoi(arg.substr(9)));
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: " << flush;
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: " << flush;
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n" << flush;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): " << flush;
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n" << flush;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+    if (numOutposts == 0 || numUAVs == 0)
+    {
+        cout << "\nNothing to allocate.\n";
+        return 0;
+    }
+
+    Instance inst{uavs, outposts, vector<double>(numOutposts)};
+    for (int o = 0; o < numOutposts; o++)
+        inst.distance[o] = calculateDistance(baseX, baseY, outposts[o].x, outposts[o].y);
+
+    vector<int> byPriority(numOutposts);
+    iota(byPriority.begin(), byPriority.end(), 0);
+    stable_sort(byPriority.begin(), byPriority.end(), [&](int a, int b)
+                { return compareByPriority(outposts[a], outposts[b]); });
+
+    Solution solution = greedyAllocation(inst, byPriority);
+    double greedyCost = solution.cost;
+    double greedyEnergy = 0;
+    for (int u = 0; u < numUAVs; u++)
+        if (solution.outpostOf[u] >= 0)
+            greedyEnergy += inst.energy(u, solution.outpostOf[u]);
+
+    ALNS alns(inst, solution, proposals, remove, threads, seed);
+    alns.run(rounds);
+
+    // Recompute from scratch to report the exact cost
+    double cost = 0, energy = 0;
+    int served = 0;
+    for (int o = 0; o < numOutposts; o++)
+    {
+        cost += solution.costOf(inst, o, solution.uavOf[o]);
+        if (solution.uavOf[o] >= 0)
+        {
+            energy += inst.energy(solution.uavOf[o], o);
+            served++;
+        }
+    }
+
+    if (!quiet)
+    {
+        cout << "\nBest UAV Allocation:\n";
+        for (int u = 0; u < numUAVs; u++)
+        {
+            int o = solution.outpostOf[u];
+            if (o >= 0)
+                cout << "UAV " << uavs[u].id << " assigned to Outpost " << outposts[o].id
+                     << " with Energy Cost: " << inst.energy(u, o) << "\n";
+        }
+    }
+
+    cout << "\nGreedy (v7) Cost: " << greedyCost << " | Total Energy: " << greedyEnergy << "\n";
+    cout << "ALNS Cost: " << cost << " (" << alns.appliedMoves() << " moves applied)\n";
+    cout << "Served Outposts: " << served << " | Total Energy: " << energy << "\n";
+
+    return 0;
+}
@@ -0,0 +1,643 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <limits>
+
+using namespace std;
+
+// Decomposition defaults (overridable from the command line)
+const int DEFAULT_CLUSTERS = 8;
+const int KMEANS_ITERATIONS = 20;
+const int PSO_PARTICLES = 50;
+const int PSO_ITERATIONS = 100;
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    double availableTime; // Time when UAV is available again
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+// One delivery in the merged plan (indices into the global vectors)
+struct Allocation
+{
+    int uav;
+    int outpost;
+    double energyCost;
+    double availableAgain; // Only meaningful for the scheduler
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+enum SolverKind
+{
+    PSO_V6,
+    GREEDY_V7,
+    SCHEDULER_V8
+};
+
+// A cluster: its outposts and the UAV subset that serves it
+struct Cluster
+{
+    vector<int> outposts;
+    vector<int> uavs;
+    double demand = 0;
+    vector<Allocation> plan;
+};
+
+// ---------------------------------------------------------------------------
+// Spatial partitioning
+// ---------------------------------------------------------------------------
+
+// k-means on (x, y) with k-means++ seeding
+vector<int> kmeansClusters(const vector<Outpost> &outposts, int k, mt19937 &rng)
+{
+    int n = outposts.size();
+    vector<double> cx, cy;
+    uniform_int_distribution<int> anyOutpost(0, n - 1);
+    int first = anyOutpost(rng);
+    cx.push_back(outposts[first].x);
+    cy.push_back(outposts[first].y);
+
+    vector<double> nearest(n, numeric_limits<double>::max());
+    while ((int)cx.size() < k)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            double dx = outposts[i].x - cx.back(), dy = outposts[i].y - cy.back();
+            nearest[i] = min(nearest[i], dx * dx + dy * dy);
+        }
+        discrete_distribution<int> pick(nearest.begin(), nearest.end());
+        int next = pick(rng);
+        cx.push_back(outposts[next].x);
+        cy.push_back(outposts[next].y);
+    }
+
+    vector<int> label(n, 0);
+    for (int iter = 0; iter < KMEANS_ITERATIONS; iter++)
+    {
+        bool changed = false;
+        for (int i = 0; i < n; i++)
+        {
+            int best = 0;
+            double bestD = numeric_limits<double>::max();
+            for (int c = 0; c < k; c++)
+            {
+                double dx = outposts[i].x - cx[c], dy = outposts[i].y - cy[c];
+                if (dx * dx + dy * dy < bestD)
+                    bestD = dx * dx + dy * dy, best = c;
+            }
+            changed |= label[i] != best;
+            label[i] = best;
+        }
+        if (!changed && iter > 0)
+            break;
+
+        vector<double> sx(k, 0), sy(k, 0);
+        vector<int> count(k, 0);
+        for (int i = 0; i < n; i++)
+        {
+            sx[label[i]] += outposts[i].x;
+            sy[label[i]] += outposts[i].y;
+            count[label[i]]++;
+        }
+        for (int c = 0; c < k; c++)
+        {
+            if (count[c] > 0)
+                cx[c] = sx[c] / count[c], cy[c] = sy[c] / count[c];
+        }
+    }
+    return label;
+}
+
+// Uniform g x g grid over the bounding box (g = ceil(sqrt(k)))
+vector<int> gridClusters(const vector<Outpost> &outposts, int k)
+{
+    int g = max(1, (int)ceil(sqrt((double)k)));
+    double minX = numeric_limits<double>::max(), minY = minX, maxX = -minX, maxY = -minX;
+    for (const auto &o : outposts)
+    {
+        minX = min(minX, o.x), maxX = max(maxX, o.x);
+        minY = min(minY, o.y), maxY = max(maxY, o.y);
+    }
+    double w = max((maxX - minX) / g, 1e-9), h = max((maxY - minY) / g, 1e-9);
+
+    vector<int> label(outposts.size());
+    for (size_t i = 0; i < outposts.size(); i++)
+    {
+        int x = min(g - 1, (int)((outposts[i].x - minX) / w));
+        int y = min(g - 1, (int)((outposts[i].y - minY) / h));
+        label[i] = y * g + x;
+    }
+    return label;
+}
+
+// Hand out UAVs in proportion to cluster demand (largest remainder). UAVs are
+// dealt in order of range so every cluster gets a mix of short and long range.
+void distributeUAVs(vector<Cluster> &clusters, const vector<UAV> &uavs)
+{
+    double totalDemand = 0;
+    for (const auto &c : clusters)
+        totalDemand += c.demand;
+
+    int m = uavs.size();
+    vector<int> quota(clusters.size(), 0);
+    vector<pair<double, int>> remainder;
+    int given = 0;
+    for (size_t c = 0; c < clusters.size(); c++)
+    {
+        double share = totalDemand > 0 ? m * clusters[c].demand / totalDemand : 0;
+        quota[c] = (int)share;
+        given += quota[c];
+        remainder.push_back({share - quota[c], (int)c});
+    }
+    sort(remainder.rbegin(), remainder.rend());
+    for (int i = 0; given < m; i = (i + 1) % remainder.size(), given++)
+        quota[remainder[i].second]++;
+
+    vector<int> byRange(m);
+    iota(byRange.begin(), byRange.end(), 0);
+    sort(byRange.begin(), byRange.end(), [&](int a, int b)
+         { return uavs[a].totalEnergy / uavs[a].energyPerKm > uavs[b].totalEnergy / uavs[b].energyPerKm; });
+
+    for (int u : byRange)
+    {
+        // Cluster furthest below its quota takes the next UAV
+        int best = -1;
+        double bestFill = numeric_limits<double>::max();
+        for (size_t c = 0; c < clusters.size(); c++)
+        {
+            if ((int)clusters[c].uavs.size() >= quota[c])
+                continue;
+            double fill = (double)clusters[c].uavs.size() / quota[c];
+            if (fill < bestFill)
+                bestFill = fill, best = c;
+        }
+        clusters[best].uavs.push_back(u);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Per-cluster solvers (same rules as v6, v7 and v8, on index subsets)
+// ---------------------------------------------------------------------------
+
+struct SubProblem
+{
+    const vector<UAV> &uavs;
+    const vector<Outpost> &outposts;
+    const vector<double> &distance; // Base to outpost
+    const vector<int> &uavSet;
+    const vector<int> &outpostSet;
+};
+
+// v6 PSO: each UAV of the cluster picks one outpost of the cluster
+double fitnessFunction(const vector<int> &assignment, const SubProblem &sp)
+{
+    double total_energy_cost = 0.0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int o = sp.outpostSet[assignment[i]];
+        const UAV &uav = sp.uavs[sp.uavSet[i]];
+        double energy_required = sp.distance[o] * uav.energyPerKm;
+        if (energy_required > uav.totalEnergy || sp.outposts[o].priority == 0)
+            return numeric_limits<double>::max();
+        total_energy_cost += energy_required / sp.outposts[o].priority;
+    }
+    return total_energy_cost;
+}
+
+vector<Allocation> psoSolve(const SubProblem &sp, unsigned seed)
+{
+    struct Particle
+    {
+        vector<int> position, best_position;
+        double fitness, best_fitness;
+    };
+
+    mt19937 rng(seed); // rand() is not thread-safe, so every cluster has its own generator
+    int m = sp.uavSet.size(), n = sp.outpostSet.size();
+    uniform_int_distribution<int> anyOutpost(0, n - 1);
+    vector<Particle> swarm(PSO_PARTICLES);
+    for (auto &p : swarm)
+    {
+        for (int j = 0; j < m; j++)
+            p.position.push_back(anyOutpost(rng));
+        p.fitness = p.best_fitness = numeric_limits<double>::max();
+        p.best_position = p.position;
+    }
+
+    vector<int> global_best_position = swarm[0].position;
+    double global_best_fitness = numeric_limits<double>::max();
+    for (int iter = 0; iter < PSO_ITERATIONS; iter++)
+    {
+        for (auto &particle : swarm)
+        {
+            particle.fitness = fitnessFunction(particle.position, sp);
+            if (particle.fitness < particle.best_fitness)
+            {
+                particle.best_fitness = particle.fitness;
+                particle.best_position = particle.position;
+            }
+            if (particle.fitness < global_best_fitness)
+            {
+                global_best_fitness = particle.fitness;
+                global_best_position = particle.position;
+            }
+        }
+        for (auto &particle : swarm)
+        {
+            for (int i = 0; i < m; i++)
+                particle.position[i] = (rng() & 1) ? particle.best_position[i] : global_best_position[i];
+        }
+    }
+
+    // Keep feasible, non-duplicate picks; the rest are left to the repair pass
+    vector<Allocation> plan;
+    vector<bool> taken(n, false);
+    for (int i = 0; i < m; i++)
+    {
+        int local = global_best_position[i];
+        int u = sp.uavSet[i], o = sp.outpostSet[local];
+        double energy = sp.distance[o] * sp.uavs[u].energyPerKm;
+        if (!taken[local] && energy <= sp.uavs[u].totalEnergy)
+        {
+            taken[local] = true;
+            plan.push_back({u, o, energy, 0});
+        }
+    }
+    return plan;
+}
+
+// v7 greedy: priority order, first free UAV with enough energy
+vector<Allocation> greedySolve(const SubProblem &sp)
+{
+    vector<int> order = sp.outpostSet;
+    stable_sort(order.begin(), order.end(), [&](int a, int b)
+                { return sp.outposts[a].priority > sp.outposts[b].priority; });
+
+    vector<Allocation> plan;
+    vector<bool> assignedUAVs(sp.uavSet.size(), false);
+    for (int o : order)
+    {
+        for (size_t j = 0; j < sp.uavSet.size(); j++)
+        {
+            int u = sp.uavSet[j];
+            double energyCost = sp.distance[o] * sp.uavs[u].energyPerKm;
+            if (!assignedUAVs[j] && energyCost <= sp.uavs[u].totalEnergy)
+            {
+                plan.push_back({u, o, energyCost, 0});
+                assignedUAVs[j] = true;
+                break;
+            }
+        }
+    }
+    return plan;
+}
+
+// v8 scheduler: priority order, earliest-available UAV that can do the round trip
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time;
+    }
+    bool operator<(const Task &other) const
+    {
+        return time < other.time;
+    }
+};
+
+vector<Allocation> scheduleSolve(const SubProblem &sp, vector<double> &availableTime)
+{
+    vector<int> order = sp.outpostSet;
+    stable_sort(order.begin(), order.end(), [&](int a, int b)
+                { return sp.outposts[a].priority > sp.outposts[b].priority; });
+
+    priority_queue<Task, vector<Task>, greater<Task>> pq;
+    for (int u : sp.uavSet)
+        pq.push({availableTime[u], u});
+
+    vector<Allocation> plan;
+    vector<Task> tempUAVs;
+    for (int o : order)
+    {
+        tempUAVs.clear();
+        while (!pq.empty())
+        {
+            Task task = pq.top();
+            pq.pop();
+            const UAV &uav = sp.uavs[task.uavIndex];
+            double energyCost = sp.distance[o] * uav.energyPerKm * 2; // Round trip
+            if (energyCost <= uav.totalEnergy)
+            {
+                double travelTime = sp.distance[o] / 10.0; // Assume 10 units speed
+                availableTime[task.uavIndex] = task.time + 2 * travelTime;
+                pq.push({availableTime[task.uavIndex], task.uavIndex});
+                plan.push_back({task.uavIndex, o, energyCost, availableTime[task.uavIndex]});
+                break;
+            }
+            tempUAVs.push_back(task);
+        }
+        for (auto &task : tempUAVs)
+            pq.push(task);
+    }
+    return plan;
+}
+
+// ---------------------------------------------------------------------------
+// Boundary repair: outposts a cluster could not serve with its own UAVs are
+// offered to the whole fleet (idle UAVs for PSO/greedy, any UAV for the scheduler)
+// ---------------------------------------------------------------------------
+
+void repairUnserved(vector<Allocation> &plan, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                    const vector<double> &distance, SolverKind solver, vector<double> &availableTime)
+{
+    vector<bool> served(outposts.size(), false), busy(uavs.size(), false);
+    for (const auto &a : plan)
+        served[a.outpost] = true, busy[a.uav] = true;
+
+    vector<int> unserved;
+    for (size_t o = 0; o < outposts.size(); o++)
+        if (!served[o])
+            unserved.push_back(o);
+    if (unserved.empty())
+        return;
+
+    vector<int> all(uavs.size());
+    iota(all.begin(), all.end(), 0);
+
+    if (solver == SCHEDULER_V8)
+    {
+        SubProblem sp{uavs, outposts, distance, all, unserved};
+        vector<Allocation> extra = scheduleSolve(sp, availableTime);
+        plan.insert(plan.end(), extra.begin(), extra.end());
+        return;
+    }
+
+    vector<int> idle;
+    for (size_t u = 0; u < uavs.size(); u++)
+        if (!busy[u])
+            idle.push_back(u);
+    SubProblem sp{uavs, outposts, distance, idle, unserved};
+    vector<Allocation> extra = greedySolve(sp);
+    plan.insert(plan.end(), extra.begin(), extra.end());
+}
+
+// Scheduler only: clusters finish at different times, so the last trip of the
+// latest UAV moves to whichever UAV in the fleet would finish it earlier
+// (across cluster borders) until the makespan stops improving
+void rebalanceSchedule(vector<Allocation> &plan, const vector<UAV> &uavs, vector<double> &availableTime)
+{
+    int m = uavs.size();
+    vector<vector<int>> trips(m); // Plan entries per UAV in flight order
+    for (size_t i = 0; i < plan.size(); i++)
+        trips[plan[i].uav].push_back(i);
+    for (auto &list : trips)
+        sort(list.begin(), list.end(), [&](int a, int b)
+             { return plan[a].availableAgain < plan[b].availableAgain; });
+
+    priority_queue<Task> latest; // Max-heap on finish time
+    priority_queue<Task, vector<Task>, greater<Task>> earliest;
+    for (int u = 0; u < m; u++)
+    {
+        latest.push({availableTime[u], u});
+        earliest.push({availableTime[u], u});
+    }
+
+    vector<Task> tempUAVs;
+    while (!latest.empty())
+    {
+        Task top = latest.top();
+        latest.pop();
+        int from = top.uavIndex;
+        if (top.time != availableTime[from])
+            continue; // Stale entry
+        if (trips[from].empty())
+            break;
+
+        Allocation &last = plan[trips[from].back()];
+        double duration = last.availableAgain - (trips[from].size() > 1 ? plan[trips[from][trips[from].size() - 2]].availableAgain : 0);
+        double energy = last.energyCost / uavs[from].energyPerKm; // Round-trip distance
+
+        // Earliest-finishing UAV that can fly this trip (v8 rule)
+        int to = -1;
+        tempUAVs.clear();
+        while (!earliest.empty())
+        {
+            Task task = earliest.top();
+            earliest.pop();
+            if (task.time != availableTime[task.uavIndex])
+                continue;
+            tempUAVs.push_back(task);
+            if (task.uavIndex != from && energy * uavs[task.uavIndex].energyPerKm <= uavs[task.uavIndex].totalEnergy)
+            {
+                to = task.uavIndex;
+                break;
+            }
+        }
+        for (auto &task : tempUAVs)
+            earliest.push(task);
+
+        if (to < 0 || availableTime[to] + duration >= top.time)
+            break; // The latest trip cannot finish earlier anywhere: makespan is final
+
+        availableTime[from] -= duration;
+        availableTime[to] += duration;
+        last.uav = to;
+        last.energyCost = energy * uavs[to].energyPerKm;
+        last.availableAgain = availableTime[to];
+        trips[to].push_back(trips[from].back());
+        trips[from].pop_back();
+        latest.push({availableTime[from], from});
+        latest.push({availableTime[to], to});
+        earliest.push({availableTime[from], from});
+        earliest.push({availableTime[to], to});
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --solver=pso|greedy|schedule  --clusters=K  --partition=kmeans|grid
+    //          --threads=T  --seed=S  --quiet
+    SolverKind solver = GREEDY_V7;
+    int k = DEFAULT_CLUSTERS;
+    bool useGrid = false;
+    int threads = max(1u, thread::hardware_concurrency());
+    unsigned seed = 0;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--solver=pso")
+            solver = PSO_V6;
+        else if (arg == "--solver=greedy")
+            solver = GREEDY_V7;
+        else if (arg == "--solver=schedule")
+            solver = SCHEDULER_V8;
+        else if (arg.rfind("--clusters=", 0) == 0)
+            k = max(1, stoi(arg.substr(11)));
+        else if (arg == "--partition=kmeans")
+            useGrid = false;
+        else if (arg == "--partition=grid")
+            useGrid = true;
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: " << flush;
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: " << flush;
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n" << flush;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+        uavs[i].availableTime = 0;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): " << flush;
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n" << flush;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+    if (numOutposts == 0 || numUAVs == 0)
+    {
+        cout << "\nNothing to allocate.\n";
+        return 0;
+    }
+
+    vector<double> distance(numOutposts);
+    for (int o = 0; o < numOutposts; o++)
+        distance[o] = calculateDistance(baseX, baseY, outposts[o].x, outposts[o].y);
+
+    // 1. Partition outposts and drop empty clusters
+    mt19937 rng(seed);
+    k = min(k, numOutposts);
+    vector<int> label = useGrid ? gridClusters(outposts, k) : kmeansClusters(outposts, k, rng);
+    int numLabels = *max_element(label.begin(), label.end()) + 1;
+    vector<Cluster> clusters(numLabels);
+    for (int o = 0; o < numOutposts; o++)
+    {
+        clusters[label[o]].outposts.push_back(o);
+        // Demand as delivery effort: supplies times distance flown from the base
+        clusters[label[o]].demand += (outposts[o].medicine + outposts[o].food + outposts[o].weapons) * max(distance[o], 1e-6);
+    }
+    clusters.erase(remove_if(clusters.begin(), clusters.end(), [](const Cluster &c)
+                             { return c.outposts.empty(); }),
+                   clusters.end());
+
+    // 2. UAV subsets in proportion to demand
+    distributeUAVs(clusters, uavs);
+
+    // 3. Solve the clusters concurrently
+    vector<double> availableTime(numUAVs, 0); // Each cluster only touches its own UAVs
+    atomic<size_t> nextCluster{0};
+    vector<thread> workers;
+    for (int t = 0; t < min(threads, (int)clusters.size()); t++)
+    {
+        workers.emplace_back([&]
+                             {
+            for (size_t c = nextCluster++; c < clusters.size(); c = nextCluster++)
+            {
+                Cluster &cluster = clusters[c];
+                if (cluster.uavs.empty())
+                    continue;
+                SubProblem sp{uavs, outposts, distance, cluster.uavs, cluster.outposts};
+                if (solver == PSO_V6)
+                    cluster.plan = psoSolve(sp, seed + 7919 * (unsigned)c);
+                else if (solver == GREEDY_V7)
+                    cluster.plan = greedySolve(sp);
+                else
+                    cluster.plan = scheduleSolve(sp, availableTime);
+            } });
+    }
+    for (auto &w : workers)
+        w.join();
+
+    // 4. Merge and repair across cluster boundaries
+    vector<Allocation> plan;
+    for (const auto &cluster : clusters)
+        plan.insert(plan.end(), cluster.plan.begin(), cluster.plan.end());
+    size_t beforeRepair = plan.size();
+    repairUnserved(plan, uavs, outposts, distance, solver, availableTime);
+    if (solver == SCHEDULER_V8)
+        rebalanceSchedule(plan, uavs, availableTime);
+
+    double totalEnergy = 0, makespan = 0;
+    for (const auto &a : plan)
+    {
+        totalEnergy += a.energyCost;
+        makespan = max(makespan, a.availableAgain);
+    }
+
+    cout << "\n";
+    for (size_t c = 0; c < clusters.size(); c++)
+    {
+        cout << "Cluster " << c + 1 << ": " << clusters[c].outposts.size() << " outposts, "
+             << clusters[c].uavs.size() << " UAVs, " << clusters[c].plan.size() << " deliveries\n";
+    }
+
+    if (!quiet)
+    {
+        cout << "\nBest UAV Allocation:\n";
+        for (const auto &a : plan)
+        {
+            cout << "UAV " << uavs[a.uav].id << " assigned to Outpost " << outposts[a.outpost].id
+                 << " with Energy Cost: " << a.energyCost;
+            if (solver == SCHEDULER_V8)
+                cout << " | Available Again At: " << a.availableAgain;
+            cout << "\n";
+        }
+    }
+
+    cout << "\nDeliveries: " << plan.size() << " (" << plan.size() - beforeRepair << " from boundary repair)"
+         << " | Unserved Outposts: " << numOutposts - (long long)plan.size()
+         << " | Total Energy: " << totalEnergy;
+    if (solver == SCHEDULER_V8)
+        cout << " | Makespan: " << makespan;
+    cout << "\n";
+
+    return 0;
+}
@@ -0,0 +1,545 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <string>
+#include <functional>
+#include <array>
+
+using namespace std;
+
+// Constants for priority calculation weights (same as v6)
+const double ALPHA = 0.5; // Weight for resource urgency
+const double BETA = 0.3;  // Weight for distance (inverted)
+const double GAMMA = 0.2; // Weight for criticality level
+
+// NSGA-II defaults (overridable from the command line)
+const int DEFAULT_POPULATION = 100;
+const int DEFAULT_GENERATIONS = 200;
+const double CROSSOVER_RATE = 0.9;
+const double UAV_SPEED = 10.0;            // Same fixed speed as v8
+const int PARALLEL_SORT_THRESHOLD = 2048; // Smaller merges are not worth a thread
+
+const int NUM_OBJECTIVES = 3;
+enum Objective
+{
+    ENERGY,    // Total round-trip energy
+    UNCOVERED, // Priority of outposts left unserved (= total - covered)
+    MAKESPAN   // Latest time any UAV finishes its sorties
+};
+
+// Structure for UAVs
+struct UAV
+{
+    int id;
+    double weight_capacity;
+    double energy_per_km;
+    double total_energy;
+};
+
+// Structure for Outposts
+struct Outpost
+{
+    int id;
+    double medicine;
+    double food;
+    double weapons;
+    double x, y;
+    double priority; // Calculated dynamically
+};
+
+// Structure for Base Station
+struct BaseStation
+{
+    double x, y;
+};
+
+// Function to calculate Euclidean distance
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Function to calculate priority for an outpost (same as v6)
+double calculatePriority(const Outpost &outpost, const BaseStation &base)
+{
+    double resource_urgency = outpost.medicine + outpost.food + outpost.weapons;
+    double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+
+    // Avoid division by zero
+    double distance_factor = (distance > 0) ? (1.0 / distance) : 1.0;
+
+    return ALPHA * resource_urgency + BETA * distance_factor + GAMMA * outpost.priority;
+}
+
+// Individual: for every outpost the UAV that serves it (-1 = unserved).
+// UAVs fly their outposts as separate sorties, as in the v8 scheduler.
+struct Individual
+{
+    vector<int> assignment;
+    double objectives[NUM_OBJECTIVES];
+    int rank;
+    double crowding;
+};
+
+struct Problem
+{
+    const vector<UAV> &uavs;
+    const vector<Outpost> &outposts;
+    vector<double> distance;  // Base to outpost
+    vector<int> byRange;      // UAV indices, longest range first
+    vector<double> rangeDesc; // Matching ranges (max outpost distance for a round trip)
+    double totalPriority = 0;
+
+    Problem(const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base)
+        : uavs(uavs), outposts(outposts), distance(outposts.size()), byRange(uavs.size())
+    {
+        for (size_t o = 0; o < outposts.size(); o++)
+        {
+            distance[o] = calculateDistance(base.x, base.y, outposts[o].x, outposts[o].y);
+            totalPriority += outposts[o].priority;
+        }
+        iota(byRange.begin(), byRange.end(), 0);
+        auto range = [&](int u)
+        { return uavs[u].total_energy / (2 * uavs[u].energy_per_km); };
+        sort(byRange.begin(), byRange.end(), [&](int a, int b)
+             { return range(a) > range(b); });
+        for (int u : byRange)
+            rangeDesc.push_back(range(u));
+    }
+
+    // Number of UAVs able to reach outpost o; they are byRange[0 .. count)
+    int capableUAVs(int o) const
+    {
+        return upper_bound(rangeDesc.begin(), rangeDesc.end(), distance[o], greater<double>()) - rangeDesc.begin();
+    }
+
+    void evaluate(Individual &ind, vector<double> &busy) const
+    {
+        fill(busy.begin(), busy.end(), 0.0);
+        double energy = 0, covered = 0;
+        for (size_t o = 0; o < ind.assignment.size(); o++)
+        {
+            int u = ind.assignment[o];
+            if (u < 0)
+                continue;
+            energy += 2 * distance[o] * uavs[u].energy_per_km;
+            busy[u] += 2 * distance[o] / UAV_SPEED;
+            covered += outposts[o].priority;
+        }
+        ind.objectives[ENERGY] = energy;
+        ind.objectives[UNCOVERED] = totalPriority - covered;
+        ind.objectives[MAKESPAN] = busy.empty() ? 0 : *max_element(busy.begin(), busy.end());
+    }
+};
+
+// Runs fn(i) for i in [0, n) on up to `threads` threads
+void parallelFor(int n, int threads, const function<void(int)> &fn)
+{
+    threads = max(1, min(threads, n));
+    if (threads == 1)
+    {
+        for (int i = 0; i < n; i++)
+            fn(i);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]
+                             {
+            for (int i = t; i < n; i += threads)
+                fn(i); });
+    }
+    for (auto &w : workers)
+        w.join();
+}
+
+// ---------------------------------------------------------------------------
+// Non-dominated sorting for three objectives.
+// Points are sorted by (f0, f1, f2), so every dominator of a point comes before
+// it. Divide and conquer on that order: rank the left half, push its ranks into
+// the right half with a sweep on f1 and a Fenwick tree (prefix max) on f2, then
+// rank the right half. O(N log^2 N) instead of the O(N^2) pairwise sort.
+// Identical objective vectors are collapsed first and share a rank.
+// ---------------------------------------------------------------------------
+
+class ParetoSorter
+{
+public:
+    ParetoSorter(int threads) : threads(threads) {}
+
+    // Returns the 0-based front index of every point
+    vector<int> sort(const vector<array<double, NUM_OBJECTIVES>> &points)
+    {
+        int n = points.size();
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b)
+                  { return points[a] < points[b]; });
+
+        // Unique points in lexicographic order
+        pts.clear();
+        vector<int> uniqueOf(n);
+        for (int i = 0; i < n; i++)
+        {
+            if (pts.empty() || points[order[i]] != pts.back())
+                pts.push_back(points[order[i]]);
+            uniqueOf[order[i]] = pts.size() - 1;
+        }
+
+        int u = pts.size();
+        vector<double> f2(u);
+        for (int i = 0; i < u; i++)
+            f2[i] = pts[i][2];
+        std::sort(f2.begin(), f2.end());
+        f2.erase(unique(f2.begin(), f2.end()), f2.end());
+        f2Rank.resize(u);
+        for (int i = 0; i < u; i++)
+            f2Rank[i] = lower_bound(f2.begin(), f2.end(), pts[i][2]) - f2.begin();
+
+        rank.assign(u, 0);
+        solve(0, u);
+
+        vector<int> result(n);
+        for (int i = 0; i < n; i++)
+            result[i] = rank[uniqueOf[i]];
+        return result;
+    }
+
+private:
+    int threads;
+    vector<array<double, NUM_OBJECTIVES>> pts;
+    vector<int> f2Rank, rank;
+
+    void solve(int l, int r)
+    {
+        if (r - l <= 1)
+            return;
+        int mid = (l + r) / 2;
+        solve(l, mid);
+        contribute(l, mid, r);
+        solve(mid, r);
+    }
+
+    // rank[q] = max(rank[q], rank[p] + 1) for left p dominating right q.
+    // With unique points sorted lexicographically, p is before q, so p dominates
+    // q exactly when f1(p) <= f1(q) and f2(p) <= f2(q).
+    void contribute(int l, int mid, int r)
+    {
+        vector<int> left(mid - l);
+        iota(left.begin(), left.end(), l);
+        auto byF1 = [&](int a, int b)
+        { return pts[a][1] < pts[b][1]; };
+        std::sort(left.begin(), left.end(), byF1);
+
+        // Fenwick keys: the f2 ranks present in the left half only, so each
+        // call costs O((r - l) log) rather than the global number of f2 values
+        vector<int> keys(left.size());
+        for (size_t i = 0; i < left.size(); i++)
+            keys[i] = f2Rank[left[i]];
+        std::sort(keys.begin(), keys.end());
+        keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        int numKeys = keys.size();
+
+        // Large merges: split the right half across threads; each chunk sweeps
+        // the whole left half with its own Fenwick tree
+        int chunks = (r - l >= PARALLEL_SORT_THRESHOLD) ? threads : 1;
+        parallelFor(chunks, chunks, [&](int c)
+                    {
+            int from = mid + (long long)(r - mid) * c / chunks;
+            int to = mid + (long long)(r - mid) * (c + 1) / chunks;
+            vector<int> right(to - from);
+            iota(right.begin(), right.end(), from);
+            std::sort(right.begin(), right.end(), byF1);
+
+            vector<int> fenwick(numKeys + 1, -1);
+            size_t i = 0;
+            for (int q : right)
+            {
+                while (i < left.size() && pts[left[i]][1] <= pts[q][1])
+                {
+                    int key = lower_bound(keys.begin(), keys.end(), f2Rank[left[i]]) - keys.begin();
+                    for (int k = key + 1; k <= numKeys; k += k & -k)
+                        fenwick[k] = max(fenwick[k], rank[left[i]]);
+                    i++;
+                }
+                int best = -1;
+                int below = upper_bound(keys.begin(), keys.end(), f2Rank[q]) - keys.begin(); // Keys <= f2(q)
+                for (int k = below; k > 0; k -= k & -k)
+                    best = max(best, fenwick[k]);
+                rank[q] = max(rank[q], best + 1);
+            } });
+    }
+};
+
+// Crowding distance of one front (indices into the population)
+void crowdingDistance(vector<Individual> &pop, vector<int> front)
+{
+    for (int i : front)
+        pop[i].crowding = 0;
+    if (front.size() <= 2)
+    {
+        for (int i : front)
+            pop[i].crowding = numeric_limits<double>::infinity();
+        return;
+    }
+    for (int m = 0; m < NUM_OBJECTIVES; m++)
+    {
+        sort(front.begin(), front.end(), [&](int a, int b)
+             { return pop[a].objectives[m] < pop[b].objectives[m]; });
+        double lo = pop[front.front()].objectives[m], hi = pop[front.back()].objectives[m];
+        pop[front.front()].crowding = pop[front.back()].crowding = numeric_limits<double>::infinity();
+        if (hi - lo <= 0)
+            continue;
+        for (size_t k = 1; k + 1 < front.size(); k++)
+            pop[front[k]].crowding += (pop[front[k + 1]].objectives[m] - pop[front[k - 1]].objectives[m]) / (hi - lo);
+    }
+}
+
+class NSGA2
+{
+public:
+    NSGA2(const Problem &problem, int populationSize, int threads, unsigned seed)
+        : problem(problem), size(populationSize), threads(threads), sorter(threads), rng(seed) {}
+
+    vector<Individual> run(int generations)
+    {
+        vector<Individual> pop = initialPopulation();
+        evaluateAll(pop);
+        rankAndCrowd(pop);
+
+        for (int gen = 0; gen < generations; gen++)
+        {
+            vector<Individual> offspring;
+            while ((int)offspring.size() < size)
+            {
+                const Individual &a = tournament(pop), &b = tournament(pop);
+                Individual child = crossover(a, b);
+                mutate(child);
+                offspring.push_back(move(child));
+            }
+            evaluateAll(offspring);
+
+            // Elitist survival from parents + offspring
+            pop.insert(pop.end(), make_move_iterator(offspring.begin()), make_move_iterator(offspring.end()));
+            vector<vector<int>> fronts = rankAndCrowd(pop);
+            vector<Individual> next;
+            for (auto &front : fronts)
+            {
+                if (next.size() + front.size() > (size_t)size)
+                {
+                    sort(front.begin(), front.end(), [&](int x, int y)
+                         { return pop[x].crowding > pop[y].crowding; });
+                    front.resize(size - next.size());
+                }
+                for (int i : front)
+                    next.push_back(move(pop[i]));
+                if ((int)next.size() == size)
+                    break;
+            }
+            pop = move(next);
+            rankAndCrowd(pop);
+        }
+
+        vector<Individual> front;
+        for (auto &ind : pop)
+            if (ind.rank == 0)
+                front.push_back(ind);
+        return front;
+    }
+
+private:
+    const Problem &problem;
+    int size, threads;
+    ParetoSorter sorter;
+    mt19937 rng;
+
+    int randomCapableUAV(int o)
+    {
+        int count = problem.capableUAVs(o);
+        if (count == 0)
+            return -1;
+        return problem.byRange[uniform_int_distribution<int>(0, count - 1)(rng)];
+    }
+
+    // Individuals spread from "serve nothing" to "serve everything"
+    vector<Individual> initialPopulation()
+    {
+        int n = problem.outposts.size();
+        vector<Individual> pop(size);
+        for (int i = 0; i < size; i++)
+        {
+            double share = size > 1 ? (double)i / (size - 1) : 1.0;
+            pop[i].assignment.assign(n, -1);
+            for (int o = 0; o < n; o++)
+                if (uniform_real_distribution<double>(0, 1)(rng) < share)
+                    pop[i].assignment[o] = randomCapableUAV(o);
+        }
+        return pop;
+    }
+
+    void evaluateAll(vector<Individual> &pop)
+    {
+        int chunks = max(1, threads);
+        parallelFor(chunks, threads, [&](int c)
+                    {
+            vector<double> busy(problem.uavs.size());
+            for (size_t i = c; i < pop.size(); i += chunks)
+                problem.evaluate(pop[i], busy); });
+    }
+
+    vector<vector<int>> rankAndCrowd(vector<Individual> &pop)
+    {
+        vector<array<double, NUM_OBJECTIVES>> points(pop.size());
+        for (size_t i = 0; i < pop.size(); i++)
+            for (int m = 0; m < NUM_OBJECTIVES; m++)
+                points[i][m] = pop[i].objectives[m];
+        vector<int> ranks = sorter.sort(points);
+
+        int numFronts = *max_element(ranks.begin(), ranks.end()) + 1;
+        vector<vector<int>> fronts(numFronts);
+        for (size_t i = 0; i < pop.size(); i++)
+        {
+            pop[i].rank = ranks[i];
+            fronts[ranks[i]].push_back(i);
+        }
+        parallelFor(numFronts, threads, [&](int f)
+                    { crowdingDistance(pop, fronts[f]); });
+        return fronts;
+    }
+
+    // Binary tournament on (rank, crowding)
+    const Individual &tournament(const vector<Individual> &pop)
+    {
+        uniform_int_distribution<int> pick(0, pop.size() - 1);
+        const Individual &a = pop[pick(rng)], &b = pop[pick(rng)];
+        if (a.rank != b.rank)
+            return a.rank < b.rank ? a : b;
+        return a.crowding >= b.crowding ? a : b;
+    }
+
+    Individual crossover(const Individual &a, const Individual &b)
+    {
+        Individual child;
+        child.assignment = a.assignment;
+        if (uniform_real_distribution<double>(0, 1)(rng) < CROSSOVER_RATE)
+        {
+            for (size_t o = 0; o < child.assignment.size(); o++)
+                if (rng() & 1)
+                    child.assignment[o] = b.assignment[o];
+        }
+        return child;
+    }
+
+    // Each gene flips with probability 1/n: to unserved, or to a capable UAV
+    void mutate(Individual &ind)
+    {
+        int n = ind.assignment.size();
+        double rate = 1.0 / max(1, n);
+        for (int o = 0; o < n; o++)
+        {
+            if (uniform_real_distribution<double>(0, 1)(rng) >= rate)
+                continue;
+            ind.assignment[o] = (ind.assignment[o] >= 0 && (rng() & 1)) ? -1 : randomCapableUAV(o);
+        }
+    }
+};
+
+int main(int argc, char **argv)
+{
+    // Options: --population=N  --generations=G  --threads=T  --seed=S  --detail=K
+    int population = DEFAULT_POPULATION, generations = DEFAULT_GENERATIONS;
+    int threads = max(1u, thread::hardware_concurrency());
+    unsigned seed = 0;
+    int detail = -1;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--population=", 0) == 0)
+            population = max(4, stoi(arg.substr(13)));
+        else if (arg.rfind("--generations=", 0) == 0)
+            generations = max(0, stoi(arg.substr(14)));
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else if (arg.rfind("--detail=", 0) == 0)
+            detail = stoi(arg.substr(9));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    int n, m;
+    cout << "Enter number of outposts: ";
+    cin >> n;
+    cout << "Enter number of UAVs: ";
+    cin >> m;
+
+    vector<UAV> uavs(m);
+    vector<Outpost> outposts(n);
+    BaseStation base;
+
+    // Input UAV details
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < m; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weight_capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    // Base first: the priority calculation needs it
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> base.x >> base.y;
+
+    // Input Outpost details
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < n; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+
+        outposts[i].priority = calculatePriority(outposts[i], base);
+    }
+
+    Problem problem(uavs, outposts, base);
+    NSGA2 optimizer(problem, population, threads, seed);
+    vector<Individual> front = optimizer.run(generations);
+
+    // One row per distinct trade-off, cheapest first
+    sort(front.begin(), front.end(), [](const Individual &a, const Individual &b)
+         { return vector<double>(a.objectives, a.objectives + NUM_OBJECTIVES) < vector<double>(b.objectives, b.objectives + NUM_OBJECTIVES); });
+    front.erase(unique(front.begin(), front.end(), [](const Individual &a, const Individual &b)
+                       { return equal(a.objectives, a.objectives + NUM_OBJECTIVES, b.objectives); }),
+                front.end());
+
+    cout << "\nPareto Front (" << front.size() << " solutions):\n";
+    for (size_t k = 0; k < front.size(); k++)
+    {
+        const Individual &ind = front[k];
+        int served = n - count(ind.assignment.begin(), ind.assignment.end(), -1);
+        cout << "#" << k << " | Energy: " << ind.objectives[ENERGY]
+             << " | Priority Covered: " << problem.totalPriority - ind.objectives[UNCOVERED] << " / " << problem.totalPriority
+             << " | Makespan: " << ind.objectives[MAKESPAN]
+             << " | Outposts Served: " << served << "\n";
+    }
+
+    if (detail >= 0 && detail < (int)front.size())
+    {
+        cout << "\nUAV Allocation for #" << detail << ":\n";
+        for (int o = 0; o < n; o++)
+        {
+            int u = front[detail].assignment[o];
+            if (u >= 0)
+                cout << "UAV " << uavs[u].id << " assigned to Outpost " << outposts[o].id << "\n";
+        }
+    }
+
+    return 0;
+}
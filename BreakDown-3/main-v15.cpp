@@ -0,0 +1,475 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+using namespace std;
+
+// Constants for priority calculation weights (same as v6)
+const double ALPHA = 0.5; // Weight for resource urgency
+const double BETA = 0.3;  // Weight for distance (inverted)
+const double GAMMA = 0.2; // Weight for criticality level
+
+// Cache defaults (overridable from the command line)
+const size_t DEFAULT_CACHE_ENTRIES = 1 << 16;
+const int CACHE_WAYS = 4;      // Entries per bucket (set-associative)
+const int CACHE_LOCKS = 256;   // Lock stripes
+const int MAX_SWAP_EVALS = 20000; // Budget for the post-PSO swap pass
+
+// Structure for UAVs
+struct UAV
+{
+    int id;
+    double weight_capacity;
+    double energy_per_km;
+    double total_energy;
+};
+
+// Structure for Outposts
+struct Outpost
+{
+    int id;
+    double medicine;
+    double food;
+    double weapons;
+    double x, y;
+    double priority; // Calculated dynamically
+};
+
+// Structure for Base Station
+struct BaseStation
+{
+    double x, y;
+};
+
+// Function to calculate Euclidean distance
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Function to calculate priority for an outpost
+double calculatePriority(const Outpost &outpost, const BaseStation &base)
+{
+    double resource_urgency = outpost.medicine + outpost.food + outpost.weapons;
+    double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+
+    // Avoid division by zero
+    double distance_factor = (distance > 0) ? (1.0 / distance) : 1.0;
+
+    return ALPHA * resource_urgency + BETA * distance_factor + GAMMA * outpost.priority;
+}
+
+// Fitness function to evaluate UAV allocation (same as v6)
+double fitnessFunction(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base)
+{
+    double total_energy_cost = 0.0;
+
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        const Outpost &outpost = outposts[outpost_id];
+        const UAV &uav = uavs[i];
+
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_required = distance * uav.energy_per_km;
+
+        if (energy_required > uav.total_energy || outpost.priority == 0)
+        {
+            return numeric_limits<double>::max(); // Invalid assignment
+        }
+
+        total_energy_cost += energy_required / outpost.priority; // Lower cost for high-priority outposts
+    }
+
+    return total_energy_cost;
+}
+
+// ---------------------------------------------------------------------------
+// Zobrist hashing of assignment vectors.
+// key(assignment) = XOR over genes of Z(i, assignment[i]). Changing one gene
+// from a to b is key ^= Z(i, a) ^ Z(i, b), so keys are maintained in O(1) per
+// gene instead of rehashing the whole vector. Z is computed with splitmix64
+// instead of a stored table, which would need UAVs x outposts entries.
+// Two independent 64-bit halves make accidental collisions negligible.
+// ---------------------------------------------------------------------------
+
+struct AssignmentKey
+{
+    uint64_t lo = 0, hi = 0;
+    bool operator==(const AssignmentKey &other) const { return lo == other.lo && hi == other.hi; }
+};
+
+uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct Zobrist
+{
+    uint64_t seed;
+
+    AssignmentKey gene(size_t i, int value) const
+    {
+        uint64_t x = (uint64_t)i << 32 | (uint32_t)value;
+        return {splitmix64(x ^ seed), splitmix64(x ^ ~seed)};
+    }
+
+    AssignmentKey hash(const vector<int> &assignment) const
+    {
+        AssignmentKey key;
+        for (size_t i = 0; i < assignment.size(); i++)
+            change(key, i, -1, assignment[i]);
+        return key;
+    }
+
+    // Gene i changes from `from` to `to` (-1 = "absent", used when building)
+    void change(AssignmentKey &key, size_t i, int from, int to) const
+    {
+        if (from == to)
+            return;
+        if (from >= 0)
+        {
+            AssignmentKey z = gene(i, from);
+            key.lo ^= z.lo, key.hi ^= z.hi;
+        }
+        AssignmentKey z = gene(i, to);
+        key.lo ^= z.lo, key.hi ^= z.hi;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Bounded concurrent fitness cache: set-associative buckets of CACHE_WAYS
+// entries, guarded by striped locks. Each entry has a small frequency counter;
+// a full bucket evicts the entry with the lowest count and ages the others, so
+// assignments that keep coming back survive and one-off ones are dropped first.
+// ---------------------------------------------------------------------------
+
+class FitnessCache
+{
+public:
+    explicit FitnessCache(size_t capacity)
+        : buckets(max<size_t>(1, capacity / CACHE_WAYS)), locks(CACHE_LOCKS) {}
+
+    bool lookup(const AssignmentKey &key, double &fitness)
+    {
+        Bucket &b = buckets[key.lo % buckets.size()];
+        lock_guard<mutex> guard(lockFor(key));
+        for (Entry &e : b.ways)
+        {
+            if (e.used && e.key == key)
+            {
+                if (e.count < 255)
+                    e.count++;
+                fitness = e.fitness;
+                hits++;
+                return true;
+            }
+        }
+        misses++;
+        return false;
+    }
+
+    void insert(const AssignmentKey &key, double fitness)
+    {
+        Bucket &b = buckets[key.lo % buckets.size()];
+        lock_guard<mutex> guard(lockFor(key));
+        Entry *victim = &b.ways[0];
+        for (Entry &e : b.ways)
+        {
+            if (e.used && e.key == key)
+                return; // Another thread got here first
+            if (!victim->used)
+                continue; // Already found a free way
+            if (!e.used || e.count < victim->count)
+                victim = &e;
+        }
+        if (victim->used)
+        {
+            evictions++;
+            for (Entry &e : b.ways)
+                e.count >>= 1; // Age the survivors
+        }
+        *victim = {key, fitness, 1, true};
+    }
+
+    // Cached evaluation; `compute` runs only on a miss
+    template <typename Compute>
+    double evaluate(const AssignmentKey &key, Compute compute)
+    {
+        double fitness;
+        if (lookup(key, fitness))
+            return fitness;
+        fitness = compute();
+        insert(key, fitness);
+        return fitness;
+    }
+
+    long long hitCount() const { return hits; }
+    long long missCount() const { return misses; }
+    long long evictionCount() const { return evictions; }
+
+private:
+    struct Entry
+    {
+        AssignmentKey key;
+        double fitness = 0;
+        uint8_t count = 0;
+        bool used = false;
+    };
+    struct Bucket
+    {
+        Entry ways[CACHE_WAYS];
+    };
+
+    vector<Bucket> buckets;
+    vector<mutex> locks;
+    atomic<long long> hits{0}, misses{0}, evictions{0};
+
+    mutex &lockFor(const AssignmentKey &key) { return locks[(key.lo % buckets.size()) % locks.size()]; }
+};
+
+// Particle for PSO; the keys follow the position vectors gene by gene
+struct Particle
+{
+    vector<int> position; // UAV assignments
+    double fitness;
+    vector<int> best_position;
+    double best_fitness;
+    AssignmentKey key, best_key;
+};
+
+// Scores particles on `threads` threads, through the cache when there is one
+void evaluateSwarm(vector<Particle> &swarm, FitnessCache *cache, int threads, const vector<UAV> &uavs,
+                   const vector<Outpost> &outposts, const BaseStation &base)
+{
+    auto work = [&](int t)
+    {
+        for (size_t i = t; i < swarm.size(); i += threads)
+        {
+            Particle &p = swarm[i];
+            auto compute = [&]
+            { return fitnessFunction(p.position, uavs, outposts, base); };
+            p.fitness = cache ? cache->evaluate(p.key, compute) : compute();
+        }
+    };
+    if (threads == 1)
+    {
+        work(0);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.emplace_back(work, t);
+    for (auto &w : workers)
+        w.join();
+}
+
+// PSO Algorithm (v6 update rule) with cached fitness
+vector<int> pso(const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base, int num_particles,
+                int iterations, const Zobrist &zobrist, FitnessCache *cache, int threads, mt19937 &rng)
+{
+    vector<Particle> swarm(num_particles);
+    uniform_int_distribution<int> anyOutpost(0, outposts.size() - 1);
+    for (auto &p : swarm)
+    {
+        for (size_t j = 0; j < uavs.size(); j++)
+            p.position.push_back(anyOutpost(rng)); // Random UAV to Outpost mapping
+        p.fitness = p.best_fitness = numeric_limits<double>::max();
+        p.best_position = p.position;
+        p.key = p.best_key = zobrist.hash(p.position);
+    }
+
+    vector<int> global_best_position = swarm[0].position;
+    double global_best_fitness = numeric_limits<double>::max();
+
+    for (int iter = 0; iter < iterations; iter++)
+    {
+        evaluateSwarm(swarm, cache, threads, uavs, outposts, base);
+
+        for (auto &particle : swarm)
+        {
+            if (particle.fitness < particle.best_fitness)
+            {
+                particle.best_fitness = particle.fitness;
+                particle.best_position = particle.position;
+                particle.best_key = particle.key;
+            }
+
+            if (particle.fitness < global_best_fitness)
+            {
+                global_best_fitness = particle.fitness;
+                global_best_position = particle.position;
+            }
+        }
+
+        // Update particles (v6 rule), keeping the key in step with each gene
+        for (auto &particle : swarm)
+        {
+            for (size_t i = 0; i < particle.position.size(); i++)
+            {
+                int next = (rng() & 1) ? particle.best_position[i] : global_best_position[i];
+                zobrist.change(particle.key, i, particle.position[i], next);
+                particle.position[i] = next;
+            }
+        }
+    }
+
+    return global_best_position;
+}
+
+// Post-PSO swap check (suggested in the v6 notes): swap the outposts of two
+// UAVs and keep the swap when it lowers the cost. Swapped keys are updated
+// incrementally, so revisited assignments come straight from the cache.
+long long swapLocalSearch(vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                          const BaseStation &base, const Zobrist &zobrist, FitnessCache *cache)
+{
+    AssignmentKey key = zobrist.hash(assignment);
+    auto score = [&](const AssignmentKey &k)
+    {
+        auto compute = [&]
+        { return fitnessFunction(assignment, uavs, outposts, base); };
+        return cache ? cache->evaluate(k, compute) : compute();
+    };
+
+    double best = score(key);
+    long long evaluations = 0, improvements = 0;
+    bool improved = true;
+    while (improved && evaluations < MAX_SWAP_EVALS)
+    {
+        improved = false;
+        for (size_t i = 0; i < assignment.size() && evaluations < MAX_SWAP_EVALS; i++)
+        {
+            for (size_t j = i + 1; j < assignment.size() && evaluations < MAX_SWAP_EVALS; j++)
+            {
+                if (assignment[i] == assignment[j])
+                    continue;
+                AssignmentKey swapped = key;
+                zobrist.change(swapped, i, assignment[i], assignment[j]);
+                zobrist.change(swapped, j, assignment[j], assignment[i]);
+                swap(assignment[i], assignment[j]);
+                double cost = score(swapped);
+                evaluations++;
+                if (cost < best)
+                {
+                    best = cost;
+                    key = swapped;
+                    improved = true;
+                    improvements++;
+                }
+                else
+                {
+                    swap(assignment[i], assignment[j]);
+                }
+            }
+        }
+    }
+    return improvements;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --particles=N  --iterations=I  --cache-size=E  --no-cache  --threads=T  --seed=S
+    int particles = 50, iterations = 100;
+    size_t cacheSize = DEFAULT_CACHE_ENTRIES;
+    bool useCache = true;
+    int threads = 1;
+    unsigned seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--particles=", 0) == 0)
+            particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            iterations = max(1, stoi(arg.substr(13)));
+        else if (arg.rfind("--cache-size=", 0) == 0)
+            cacheSize = stoull(arg.substr(13));
+        else if (arg == "--no-cache")
+            useCache = false;
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    int n, m;
+    cout << "Enter number of outposts: ";
+    cin >> n;
+    cout << "Enter number of UAVs: ";
+    cin >> m;
+
+    vector<UAV> uavs(m);
+    vector<Outpost> outposts(n);
+    BaseStation base;
+
+    // Input UAV details
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < m; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weight_capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    // Base first: the priority calculation needs it
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> base.x >> base.y;
+
+    // Input Outpost details
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < n; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+
+        outposts[i].priority = calculatePriority(outposts[i], base);
+    }
+    if (n == 0 || m == 0)
+    {
+        cout << "\nNothing to allocate.\n";
+        return 0;
+    }
+
+    mt19937 rng(seed);
+    Zobrist zobrist{splitmix64(seed)};
+    FitnessCache cache(cacheSize);
+    FitnessCache *activeCache = useCache ? &cache : nullptr;
+
+    auto start = chrono::steady_clock::now();
+    vector<int> best_allocation = pso(uavs, outposts, base, particles, iterations, zobrist, activeCache, threads, rng);
+    long long swaps = swapLocalSearch(best_allocation, uavs, outposts, base, zobrist, activeCache);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Output best UAV allocation
+    cout << "\nBest UAV Allocation:\n";
+    for (size_t i = 0; i < best_allocation.size(); i++)
+    {
+        cout << "UAV " << uavs[i].id << " assigned to Outpost " << outposts[best_allocation[i]].id << "\n";
+    }
+
+    cout << "Best Energy Cost: " << fitnessFunction(best_allocation, uavs, outposts, base) << "\n";
+    cout << "Improving Swaps: " << swaps << " | Solve Time: " << seconds << " s\n";
+    if (useCache)
+    {
+        long long lookups = cache.hitCount() + cache.missCount();
+        cout << "Fitness Cache: " << cache.hitCount() << " hits, " << cache.missCount() << " misses ("
+             << (lookups ? 100.0 * cache.hitCount() / lookups : 0) << "% hit rate), "
+             << cache.evictionCount() << " evictions\n";
+    }
+
+    return 0;
+}
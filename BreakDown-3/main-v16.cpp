@@ -0,0 +1,342 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <random>
+#include <limits>
+#include <string>
+#include <ctime>
+
+using namespace std;
+
+// Unserved outposts cost this much energy per priority level, so serving
+// more priority always beats saving energy (same idea as v12)
+const double UNSERVED_PENALTY = 1e6;
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+struct Allocation
+{
+    int uavId;
+    int outpostId;
+    double energyCost;
+};
+
+// ---------------------------------------------------------------------------
+// Reduced problem. UAVs with identical (capacity, energy/km, total energy) are
+// interchangeable, and so are outposts at the same spot with the same
+// priority. They become a type with a count and a site with a count; solvers
+// decide how many UAVs of each type go to each site.
+// ---------------------------------------------------------------------------
+
+struct UAVType
+{
+    double capacity, energyPerKm, totalEnergy;
+    vector<int> members; // Indices into the original UAV list
+};
+
+struct Site
+{
+    double x, y;
+    int priority;
+    vector<int> members; // Indices into the original outpost list
+};
+
+struct ReducedProblem
+{
+    vector<UAVType> types;
+    vector<Site> sites;
+    vector<vector<double>> cost; // cost[t][s]: energy for one UAV of type t, or -1 if out of range
+};
+
+ReducedProblem reduce(const vector<UAV> &uavs, const vector<Outpost> &outposts, double baseX, double baseY)
+{
+    ReducedProblem rp;
+
+    map<tuple<double, double, double>, int> typeOf;
+    for (size_t i = 0; i < uavs.size(); i++)
+    {
+        auto key = make_tuple(uavs[i].capacity, uavs[i].energyPerKm, uavs[i].totalEnergy);
+        auto it = typeOf.find(key);
+        if (it == typeOf.end())
+        {
+            it = typeOf.emplace(key, rp.types.size()).first;
+            rp.types.push_back({uavs[i].capacity, uavs[i].energyPerKm, uavs[i].totalEnergy, {}});
+        }
+        rp.types[it->second].members.push_back(i);
+    }
+
+    map<tuple<double, double, int>, int> siteOf;
+    for (size_t i = 0; i < outposts.size(); i++)
+    {
+        auto key = make_tuple(outposts[i].x, outposts[i].y, outposts[i].priority);
+        auto it = siteOf.find(key);
+        if (it == siteOf.end())
+        {
+            it = siteOf.emplace(key, rp.sites.size()).first;
+            rp.sites.push_back({outposts[i].x, outposts[i].y, outposts[i].priority, {}});
+        }
+        rp.sites[it->second].members.push_back(i);
+    }
+
+    rp.cost.assign(rp.types.size(), vector<double>(rp.sites.size()));
+    for (size_t t = 0; t < rp.types.size(); t++)
+    {
+        for (size_t s = 0; s < rp.sites.size(); s++)
+        {
+            double distance = calculateDistance(baseX, baseY, rp.sites[s].x, rp.sites[s].y);
+            double energyCost = distance * rp.types[t].energyPerKm;
+            rp.cost[t][s] = energyCost <= rp.types[t].totalEnergy ? energyCost : -1;
+        }
+    }
+    return rp;
+}
+
+// Reduced solution: flow[t][s] = number of UAVs of type t sent to site s
+struct ReducedSolution
+{
+    vector<vector<int>> flow;
+    double energy = 0;
+    long long servedPriority = 0;
+    double cost() const { return energy - UNSERVED_PENALTY * servedPriority; }
+};
+
+// Fills sites in the given order; each site takes the cheapest types that are
+// in range until it is full or no capable UAV is left. O(T) per site instead
+// of O(UAVs) per outpost.
+ReducedSolution fillSites(const ReducedProblem &rp, const vector<int> &siteOrder)
+{
+    size_t T = rp.types.size();
+    ReducedSolution sol;
+    sol.flow.assign(T, vector<int>(rp.sites.size(), 0));
+    vector<int> left(T);
+    for (size_t t = 0; t < T; t++)
+        left[t] = rp.types[t].members.size();
+
+    vector<int> byCost(T);
+    for (int s : siteOrder)
+    {
+        const Site &site = rp.sites[s];
+        int need = site.members.size();
+        for (size_t t = 0; t < T; t++)
+            byCost[t] = t;
+        sort(byCost.begin(), byCost.end(), [&](int a, int b)
+             { return rp.cost[a][s] < rp.cost[b][s]; });
+        for (int t : byCost)
+        {
+            if (need == 0)
+                break;
+            if (rp.cost[t][s] < 0 || left[t] == 0)
+                continue;
+            int sent = min(need, left[t]);
+            sol.flow[t][s] += sent;
+            left[t] -= sent;
+            need -= sent;
+            sol.energy += sent * rp.cost[t][s];
+            sol.servedPriority += (long long)sent * site.priority;
+        }
+    }
+    return sol;
+}
+
+// v7 greedy on the reduced problem: sites in descending priority
+ReducedSolution greedySolve(const ReducedProblem &rp)
+{
+    vector<int> order(rp.sites.size());
+    for (size_t s = 0; s < order.size(); s++)
+        order[s] = s;
+    stable_sort(order.begin(), order.end(), [&](int a, int b)
+                { return rp.sites[a].priority > rp.sites[b].priority; });
+    return fillSites(rp, order);
+}
+
+// PSO on the reduced problem. Each particle holds one key per site (random-key
+// encoding); decoding sorts sites by key and fills them. The swarm searches
+// over site orders only, so permuting interchangeable UAVs or outposts never
+// produces a "new" particle.
+ReducedSolution psoSolve(const ReducedProblem &rp, int numParticles, int iterations, mt19937 &rng)
+{
+    size_t S = rp.sites.size();
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    const double W = 0.7, C1 = 1.5, C2 = 1.5;
+
+    vector<int> order(S);
+    auto decode = [&](const vector<double> &keys)
+    {
+        for (size_t s = 0; s < S; s++)
+            order[s] = s;
+        sort(order.begin(), order.end(), [&](int a, int b)
+             { return keys[a] > keys[b]; });
+        return fillSites(rp, order);
+    };
+
+    // Seed one particle with the greedy order (priority as key)
+    vector<vector<double>> position(numParticles, vector<double>(S)), velocity = position;
+    for (int p = 0; p < numParticles; p++)
+        for (size_t s = 0; s < S; s++)
+            position[p][s] = p == 0 ? rp.sites[s].priority + 0.5 * unit(rng) : 5.0 * unit(rng);
+
+    vector<vector<double>> bestPosition = position;
+    vector<double> bestCost(numParticles);
+    ReducedSolution globalBest = greedySolve(rp);
+    vector<double> globalBestPosition = position[0];
+    for (int p = 0; p < numParticles; p++)
+    {
+        ReducedSolution sol = decode(position[p]);
+        bestCost[p] = sol.cost();
+        if (sol.cost() < globalBest.cost())
+        {
+            globalBest = sol;
+            globalBestPosition = position[p];
+        }
+    }
+
+    for (int iter = 0; iter < iterations; iter++)
+    {
+        for (int p = 0; p < numParticles; p++)
+        {
+            for (size_t s = 0; s < S; s++)
+            {
+                velocity[p][s] = W * velocity[p][s] + C1 * unit(rng) * (bestPosition[p][s] - position[p][s]) +
+                                 C2 * unit(rng) * (globalBestPosition[s] - position[p][s]);
+                position[p][s] += velocity[p][s];
+            }
+            ReducedSolution sol = decode(position[p]);
+            if (sol.cost() < bestCost[p])
+            {
+                bestCost[p] = sol.cost();
+                bestPosition[p] = position[p];
+            }
+            if (sol.cost() < globalBest.cost())
+            {
+                globalBest = sol;
+                globalBestPosition = position[p];
+            }
+        }
+    }
+    return globalBest;
+}
+
+// Hands out concrete UAVs and outposts from each type/site pool
+vector<Allocation> expand(const ReducedProblem &rp, const ReducedSolution &sol, const vector<UAV> &uavs,
+                          const vector<Outpost> &outposts)
+{
+    vector<Allocation> allocations;
+    vector<size_t> nextUAV(rp.types.size(), 0), nextOutpost(rp.sites.size(), 0);
+    for (size_t s = 0; s < rp.sites.size(); s++)
+    {
+        for (size_t t = 0; t < rp.types.size(); t++)
+        {
+            for (int k = 0; k < sol.flow[t][s]; k++)
+            {
+                const UAV &uav = uavs[rp.types[t].members[nextUAV[t]++]];
+                const Outpost &outpost = outposts[rp.sites[s].members[nextOutpost[s]++]];
+                allocations.push_back({uav.id, outpost.id, rp.cost[t][s]});
+            }
+        }
+    }
+    return allocations;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --solver=greedy|pso  --particles=N  --iterations=I  --seed=S
+    string solver = "pso";
+    int particles = 30, iterations = 100;
+    unsigned seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--solver=", 0) == 0)
+            solver = arg.substr(9);
+        else if (arg.rfind("--particles=", 0) == 0)
+            particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            iterations = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (solver != "greedy" && solver != "pso")
+    {
+        cerr << "Unknown solver: " << solver << " (expected greedy or pso)\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    ReducedProblem rp = reduce(uavs, outposts, baseX, baseY);
+
+    mt19937 rng(seed);
+    ReducedSolution sol = solver == "greedy" ? greedySolve(rp) : psoSolve(rp, particles, iterations, rng);
+    vector<Allocation> allocations = expand(rp, sol, uavs, outposts);
+
+    cout << "\nBest UAV Allocation:\n";
+    for (const auto &allocation : allocations)
+    {
+        cout << "UAV " << allocation.uavId << " assigned to Outpost " << allocation.outpostId
+             << " with Energy Cost: " << allocation.energyCost << "\n";
+    }
+
+    long long totalPriority = 0;
+    for (const auto &outpost : outposts)
+        totalPriority += outpost.priority;
+    cout << "\nReduction: " << numUAVs << " UAVs -> " << rp.types.size() << " types, "
+         << numOutposts << " outposts -> " << rp.sites.size() << " sites\n";
+    cout << "Decision pairs: " << (long long)numUAVs * numOutposts << " (UAV, outpost) -> "
+         << rp.types.size() * rp.sites.size() << " (type, site)\n";
+    cout << "Served: " << allocations.size() << " outposts, priority " << sol.servedPriority << "/" << totalPriority
+         << " | Total Energy: " << sol.energy << "\n";
+
+    return 0;
+}
@@ -0,0 +1,523 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <ctime>
+
+using namespace std;
+
+// Extra cost when two UAVs end up on the same outpost (v7: one UAV per outpost)
+const double DUPLICATE_PENALTY = 1e6;
+// Chance that a PSO gene is resampled from its row instead of copied
+const double MUTATION_RATE = 0.01;
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+struct Allocation
+{
+    int uavId;
+    int outpostId;
+    double energyCost;
+};
+
+// Runs body(t) on threads t = 0..threads-1 (inline when there is only one)
+template <typename Body>
+void runThreads(int threads, Body body)
+{
+    if (threads == 1)
+    {
+        body(0);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.emplace_back(body, t);
+    for (auto &w : workers)
+        w.join();
+}
+
+// ---------------------------------------------------------------------------
+// Uniform grid over the outposts, stored CSR-style (cell -> outpost indices).
+// Used to enumerate only the cells that intersect a UAV's reachable disc.
+// ---------------------------------------------------------------------------
+
+struct OutpostGrid
+{
+    double minX = 0, minY = 0, cellSize = 1;
+    int cols = 1, rows = 1;
+    vector<int> cellStart; // rows*cols + 1 offsets
+    vector<int> items;
+
+    void build(const vector<Outpost> &outposts)
+    {
+        if (outposts.empty())
+        {
+            cellStart.assign(2, 0);
+            return;
+        }
+        double maxX = outposts[0].x, maxY = outposts[0].y;
+        minX = maxX, minY = maxY;
+        for (const auto &o : outposts)
+        {
+            minX = min(minX, o.x), maxX = max(maxX, o.x);
+            minY = min(minY, o.y), maxY = max(maxY, o.y);
+        }
+        // About two outposts per cell
+        double area = max(1e-9, (maxX - minX) * (maxY - minY));
+        cellSize = max(1e-6, sqrt(2.0 * area / outposts.size()));
+        cols = min(4096, (int)((maxX - minX) / cellSize) + 1);
+        rows = min(4096, (int)((maxY - minY) / cellSize) + 1);
+        cellSize = max((maxX - minX) / cols, (maxY - minY) / rows) * (1 + 1e-9) + 1e-9;
+
+        vector<int> cellOf(outposts.size());
+        cellStart.assign(rows * cols + 1, 0);
+        for (size_t i = 0; i < outposts.size(); i++)
+        {
+            cellOf[i] = cellIndex(outposts[i].x, outposts[i].y);
+            cellStart[cellOf[i] + 1]++;
+        }
+        partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+        items.resize(outposts.size());
+        vector<int> cursor(cellStart.begin(), cellStart.end() - 1);
+        for (size_t i = 0; i < outposts.size(); i++)
+            items[cursor[cellOf[i]]++] = i;
+    }
+
+    int cellIndex(double x, double y) const
+    {
+        int cx = min(cols - 1, max(0, (int)((x - minX) / cellSize)));
+        int cy = min(rows - 1, max(0, (int)((y - minY) / cellSize)));
+        return cy * cols + cx;
+    }
+
+    // Calls visit(outpostIndex) for every outpost in cells that touch the disc
+    template <typename Visit>
+    void forCellsInDisc(double x, double y, double radius, Visit visit) const
+    {
+        int x0 = max(0, (int)floor((x - radius - minX) / cellSize));
+        int x1 = min(cols - 1, (int)floor((x + radius - minX) / cellSize));
+        int y0 = max(0, (int)floor((y - radius - minY) / cellSize));
+        int y1 = min(rows - 1, (int)floor((y + radius - minY) / cellSize));
+        for (int cy = y0; cy <= y1; cy++)
+        {
+            double dy = max({0.0, minY + cy * cellSize - y, y - (minY + (cy + 1) * cellSize)});
+            for (int cx = x0; cx <= x1; cx++)
+            {
+                double dx = max({0.0, minX + cx * cellSize - x, x - (minX + (cx + 1) * cellSize)});
+                if (dx * dx + dy * dy > radius * radius)
+                    continue; // Cell lies entirely outside the disc
+                int c = cy * cols + cx;
+                for (int k = cellStart[c]; k < cellStart[c + 1]; k++)
+                    visit(items[k]);
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Feasibility graph: only (UAV, outpost, cost) edges with cost <= total energy.
+// CSR rows per UAV, plus the CSC transpose (columns per outpost) for solvers
+// that walk outposts. Memory is O(UAVs + outposts + feasible edges).
+// ---------------------------------------------------------------------------
+
+struct FeasibilityGraph
+{
+    // CSR: edges of UAV u are [rowStart[u], rowStart[u+1])
+    vector<long long> rowStart;
+    vector<int> edgeOutpost;
+    vector<float> edgeCost;
+
+    // CSC: UAVs that can reach outpost o are colUAV[colStart[o] .. colStart[o+1]),
+    // ascending by UAV index; colEdge maps back to the CSR edge
+    vector<long long> colStart;
+    vector<int> colUAV;
+    vector<long long> colEdge;
+
+    long long edges() const { return edgeOutpost.size(); }
+    long long rowSize(int u) const { return rowStart[u + 1] - rowStart[u]; }
+
+    size_t bytes() const
+    {
+        return rowStart.size() * sizeof(long long) + edgeOutpost.size() * sizeof(int) +
+               edgeCost.size() * sizeof(float) + colStart.size() * sizeof(long long) +
+               colUAV.size() * sizeof(int) + colEdge.size() * sizeof(long long);
+    }
+};
+
+// Two passes over the same spatial query: count row sizes, prefix-sum them into
+// offsets, then fill. Rows are independent, so each pass splits UAVs across threads.
+FeasibilityGraph buildGraph(const vector<UAV> &uavs, const vector<Outpost> &outposts, double baseX, double baseY,
+                            int threads)
+{
+    OutpostGrid grid;
+    grid.build(outposts);
+
+    size_t m = uavs.size(), n = outposts.size();
+    FeasibilityGraph g;
+    g.rowStart.assign(m + 1, 0);
+
+    auto forEachEdge = [&](size_t u, auto emit)
+    {
+        const UAV &uav = uavs[u];
+        if (uav.energyPerKm <= 0)
+        {
+            // Free flight: every outpost is reachable
+            for (size_t o = 0; o < n; o++)
+                emit(o, 0.0);
+            return;
+        }
+        double range = uav.totalEnergy / uav.energyPerKm;
+        grid.forCellsInDisc(baseX, baseY, range, [&](int o)
+                            {
+            double energyCost = calculateDistance(baseX, baseY, outposts[o].x, outposts[o].y) * uav.energyPerKm;
+            if (energyCost <= uav.totalEnergy)
+                emit(o, energyCost); });
+    };
+
+    runThreads(threads, [&](int t)
+               {
+        for (size_t u = t; u < m; u += threads)
+        {
+            long long count = 0;
+            forEachEdge(u, [&](int, double) { count++; });
+            g.rowStart[u + 1] = count;
+        } });
+    partial_sum(g.rowStart.begin(), g.rowStart.end(), g.rowStart.begin());
+
+    long long E = g.rowStart[m];
+    g.edgeOutpost.resize(E);
+    g.edgeCost.resize(E);
+    runThreads(threads, [&](int t)
+               {
+        for (size_t u = t; u < m; u += threads)
+        {
+            long long k = g.rowStart[u];
+            forEachEdge(u, [&](int o, double c)
+                        {
+                g.edgeOutpost[k] = o;
+                g.edgeCost[k] = c;
+                k++; });
+        } });
+
+    // Transpose: atomic column counts, prefix sum, atomic-cursor fill, then
+    // sort each column by UAV index so column order matches input order
+    vector<atomic<long long>> colCount(n);
+    for (auto &c : colCount)
+        c.store(0, memory_order_relaxed);
+    runThreads(threads, [&](int t)
+               {
+        for (long long e = t; e < E; e += threads)
+            colCount[g.edgeOutpost[e]].fetch_add(1, memory_order_relaxed); });
+    g.colStart.assign(n + 1, 0);
+    for (size_t o = 0; o < n; o++)
+        g.colStart[o + 1] = g.colStart[o] + colCount[o].load(memory_order_relaxed);
+    for (size_t o = 0; o < n; o++)
+        colCount[o].store(g.colStart[o], memory_order_relaxed);
+
+    g.colUAV.resize(E);
+    g.colEdge.resize(E);
+    runThreads(threads, [&](int t)
+               {
+        for (size_t u = t; u < m; u += threads)
+        {
+            for (long long e = g.rowStart[u]; e < g.rowStart[u + 1]; e++)
+            {
+                long long slot = colCount[g.edgeOutpost[e]].fetch_add(1, memory_order_relaxed);
+                g.colUAV[slot] = u;
+                g.colEdge[slot] = e;
+            }
+        } });
+    runThreads(threads, [&](int t)
+               {
+        vector<pair<int, long long>> column;
+        for (size_t o = t; o < n; o += threads)
+        {
+            long long a = g.colStart[o], b = g.colStart[o + 1];
+            column.clear();
+            for (long long k = a; k < b; k++)
+                column.push_back({g.colUAV[k], g.colEdge[k]});
+            sort(column.begin(), column.end());
+            for (long long k = a; k < b; k++)
+                g.colUAV[k] = column[k - a].first, g.colEdge[k] = column[k - a].second;
+        } });
+    return g;
+}
+
+// v7 greedy over the CSC: outposts in descending priority, each takes the
+// first free UAV (in input order) that can reach it. O(n log n + edges)
+// instead of O(n x m).
+vector<long long> greedySolve(const FeasibilityGraph &g, const vector<Outpost> &outposts, size_t numUAVs)
+{
+    vector<int> order(outposts.size());
+    iota(order.begin(), order.end(), 0);
+    // Same comparator and algorithm as v7, so ties come out in the same order
+    sort(order.begin(), order.end(), [&](int a, int b)
+         { return outposts[a].priority > outposts[b].priority; });
+
+    vector<long long> chosen(numUAVs, -1); // CSR edge per UAV, -1 = idle
+    size_t freeUAVs = numUAVs;
+    for (int o : order)
+    {
+        if (freeUAVs == 0)
+            break;
+        for (long long k = g.colStart[o]; k < g.colStart[o + 1]; k++)
+        {
+            int u = g.colUAV[k];
+            if (chosen[u] < 0)
+            {
+                chosen[u] = g.colEdge[k];
+                freeUAVs--;
+                break;
+            }
+        }
+    }
+    return chosen;
+}
+
+// ---------------------------------------------------------------------------
+// PSO over edge offsets. Gene u is an offset into row u (or -1 when the row is
+// empty), so every sampled assignment is reachable by construction. The v6
+// update rule copies each gene from the personal or the global best, with a
+// small chance of resampling from the row.
+// ---------------------------------------------------------------------------
+
+struct Particle
+{
+    vector<int> position; // Offset into each UAV's row
+    double fitness;
+    vector<int> bestPosition;
+    double bestFitness;
+};
+
+// v6 cost (energy / priority) plus a penalty per extra UAV on the same outpost.
+// `seen` is a per-thread stamp array over outposts.
+double fitnessFunction(const vector<int> &position, const FeasibilityGraph &g, const vector<Outpost> &outposts,
+                       vector<int> &seen, int stamp)
+{
+    double cost = 0;
+    for (size_t u = 0; u < position.size(); u++)
+    {
+        if (position[u] < 0)
+            continue;
+        long long e = g.rowStart[u] + position[u];
+        int o = g.edgeOutpost[e];
+        cost += g.edgeCost[e] / outposts[o].priority;
+        if (seen[o] == stamp)
+            cost += DUPLICATE_PENALTY;
+        seen[o] = stamp;
+    }
+    return cost;
+}
+
+vector<long long> psoSolve(const FeasibilityGraph &g, const vector<Outpost> &outposts, size_t numUAVs,
+                           int numParticles, int iterations, int threads, unsigned seed)
+{
+    mt19937 rng(seed);
+    auto sample = [&](mt19937 &r, size_t u)
+    {
+        long long size = g.rowSize(u);
+        return size == 0 ? -1 : (int)uniform_int_distribution<long long>(0, size - 1)(r);
+    };
+
+    vector<Particle> swarm(numParticles);
+    for (auto &p : swarm)
+    {
+        p.position.resize(numUAVs);
+        for (size_t u = 0; u < numUAVs; u++)
+            p.position[u] = sample(rng, u);
+        p.fitness = p.bestFitness = numeric_limits<double>::max();
+        p.bestPosition = p.position;
+    }
+
+    vector<vector<int>> seen(threads, vector<int>(outposts.size(), 0));
+    vector<int> stamp(threads, 0);
+    vector<mt19937> rngs;
+    for (int t = 0; t < threads; t++)
+        rngs.emplace_back(seed + 7919 * (t + 1));
+
+    vector<int> globalBest = swarm[0].position;
+    double globalBestFitness = numeric_limits<double>::max();
+    for (int iter = 0; iter <= iterations; iter++)
+    {
+        runThreads(threads, [&](int t)
+                   {
+            for (size_t i = t; i < swarm.size(); i += threads)
+                swarm[i].fitness = fitnessFunction(swarm[i].position, g, outposts, seen[t], ++stamp[t]); });
+
+        for (auto &p : swarm)
+        {
+            if (p.fitness < p.bestFitness)
+            {
+                p.bestFitness = p.fitness;
+                p.bestPosition = p.position;
+            }
+            if (p.fitness < globalBestFitness)
+            {
+                globalBestFitness = p.fitness;
+                globalBest = p.position;
+            }
+        }
+        if (iter == iterations)
+            break;
+
+        runThreads(threads, [&](int t)
+                   {
+            mt19937 &r = rngs[t];
+            uniform_real_distribution<double> unit(0.0, 1.0);
+            for (size_t i = t; i < swarm.size(); i += threads)
+            {
+                Particle &p = swarm[i];
+                for (size_t u = 0; u < numUAVs; u++)
+                {
+                    if (unit(r) < MUTATION_RATE)
+                        p.position[u] = sample(r, u);
+                    else
+                        p.position[u] = (r() & 1) ? p.bestPosition[u] : globalBest[u];
+                }
+            } });
+    }
+
+    vector<long long> chosen(numUAVs, -1);
+    vector<bool> taken(outposts.size(), false);
+    for (size_t u = 0; u < numUAVs; u++)
+    {
+        if (globalBest[u] < 0)
+            continue;
+        long long e = g.rowStart[u] + globalBest[u];
+        if (taken[g.edgeOutpost[e]])
+            continue; // Duplicate left after the search: keep the first UAV
+        taken[g.edgeOutpost[e]] = true;
+        chosen[u] = e;
+    }
+    return chosen;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --solver=greedy|pso  --particles=N  --iterations=I  --threads=T  --seed=S  --quiet
+    string solver = "greedy";
+    int particles = 30, iterations = 100, threads = max(1u, thread::hardware_concurrency());
+    unsigned seed = time(0);
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--solver=", 0) == 0)
+            solver = arg.substr(9);
+        else if (arg.rfind("--particles=", 0) == 0)
+            particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            iterations = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (solver != "greedy" && solver != "pso")
+    {
+        cerr << "Unknown solver: " << solver << " (expected greedy or pso)\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+        outposts[i].priority = max(1, outposts[i].priority); // v6 divides by it
+    }
+
+    auto start = chrono::steady_clock::now();
+    FeasibilityGraph g = buildGraph(uavs, outposts, baseX, baseY, threads);
+    double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    vector<long long> chosen = solver == "greedy" ? greedySolve(g, outposts, numUAVs)
+                                                  : psoSolve(g, outposts, numUAVs, particles, iterations, threads, seed);
+    double solveSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<Allocation> allocations;
+    double totalEnergy = 0;
+    long long servedPriority = 0;
+    for (int u = 0; u < numUAVs; u++)
+    {
+        if (chosen[u] < 0)
+            continue;
+        const Outpost &outpost = outposts[g.edgeOutpost[chosen[u]]];
+        allocations.push_back({uavs[u].id, outpost.id, g.edgeCost[chosen[u]]});
+        totalEnergy += g.edgeCost[chosen[u]];
+        servedPriority += outpost.priority;
+    }
+
+    if (!quiet)
+    {
+        cout << "\nBest UAV Allocation:\n";
+        for (const auto &allocation : allocations)
+        {
+            cout << "UAV " << allocation.uavId << " assigned to Outpost " << allocation.outpostId
+                 << " with Energy Cost: " << allocation.energyCost << "\n";
+        }
+    }
+
+    double dense = (double)numUAVs * numOutposts;
+    cout << "\nFeasible edges: " << g.edges() << " of " << dense << " pairs ("
+         << (dense > 0 ? 100.0 * g.edges() / dense : 0) << "%), graph " << g.bytes() / (1024.0 * 1024.0) << " MB\n";
+    cout << "Served: " << allocations.size() << " outposts, priority " << servedPriority
+         << " | Total Energy: " << totalEnergy << "\n";
+    cout << "Build: " << buildSeconds << " s | Solve: " << solveSeconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,455 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <unordered_set>
+
+using namespace std;
+
+struct UAV
+{
+    int id;
+    double weight_capacity, energy_per_km, total_energy;
+};
+
+struct Outpost
+{
+    int id;
+    double medicine, food, weapons, x, y;
+    int priority;
+};
+
+struct BaseStation
+{
+    double x, y;
+};
+
+// Function to calculate distance
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// ---------------------------------------------------------------------------
+// xoshiro256** generator (replaces rand()). Bounded draws use Lemire's
+// multiply-shift with rejection, so they are unbiased and need no division in
+// the common case, unlike `rand() % n`.
+// ---------------------------------------------------------------------------
+
+class Xoshiro256
+{
+public:
+    explicit Xoshiro256(uint64_t seed)
+    {
+        for (auto &word : s)
+        {
+            // splitmix64 expands the seed into the four state words
+            seed += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    uint64_t next()
+    {
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    // Uniform integer in [0, n), n > 0
+    uint64_t bounded(uint64_t n)
+    {
+        unsigned __int128 m = (unsigned __int128)next() * n;
+        uint64_t low = (uint64_t)m;
+        if (low < n)
+        {
+            uint64_t threshold = -n % n;
+            while (low < threshold)
+            {
+                m = (unsigned __int128)next() * n;
+                low = (uint64_t)m;
+            }
+        }
+        return m >> 64;
+    }
+
+    // Uniform double in [0, 1)
+    double uniform() { return (next() >> 11) * 0x1.0p-53; }
+
+private:
+    uint64_t s[4];
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+// Particle Swarm Optimization Particle
+struct Particle
+{
+    vector<int> assignment;
+    double fitness;
+    vector<int> best_assignment;
+    double best_fitness;
+
+    Particle(int numUAVs)
+    {
+        assignment.resize(numUAVs, -1);
+        fitness = best_fitness = numeric_limits<double>::max();
+    }
+};
+
+// Fitness function (v5, plus the duplicate penalty for idle UAVs: otherwise
+// mixing particles that leave different UAVs at -1 drifts towards serving nothing)
+double fitnessFunction(const Particle &p, const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base)
+{
+    double total_energy = 0;
+    unordered_set<int> assignedOutposts;
+
+    for (size_t i = 0; i < p.assignment.size(); i++)
+    {
+        int outpost_id = p.assignment[i];
+        if (outpost_id == -1)
+        {
+            total_energy += 1000;
+            continue;
+        }
+
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+
+        total_energy += energy_used;
+        total_energy += (100 / (outpost.priority + 1));
+
+        if (assignedOutposts.count(outpost_id))
+        {
+            total_energy += 1000; // Large penalty for duplicate assignments
+        }
+        assignedOutposts.insert(outpost_id);
+    }
+
+    return total_energy;
+}
+
+// ---------------------------------------------------------------------------
+// Initialization subsystem.
+//
+// Feasibility only depends on the base distance, so with outposts sorted by
+// distance each UAV's feasible set is a prefix of that order (length reach[j]).
+// Every strategy samples inside that prefix, never repeats an outpost within
+// a particle, and leaves a UAV at -1 when nothing is left, so it terminates
+// even when UAVs outnumber outposts.
+// ---------------------------------------------------------------------------
+
+struct FeasibleSet
+{
+    vector<int> byDistance; // Outpost indices, nearest first
+    vector<int> reach;      // reach[j]: UAV j can serve byDistance[0 .. reach[j])
+    vector<int> uavOrder;   // UAVs by ascending reach (most constrained first)
+
+    FeasibleSet(const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base)
+    {
+        vector<double> distance(outposts.size());
+        for (size_t i = 0; i < outposts.size(); i++)
+            distance[i] = calculateDistance(base.x, base.y, outposts[i].x, outposts[i].y);
+        byDistance.resize(outposts.size());
+        iota(byDistance.begin(), byDistance.end(), 0);
+        sort(byDistance.begin(), byDistance.end(), [&](int a, int b)
+             { return distance[a] < distance[b]; });
+
+        reach.resize(uavs.size());
+        for (size_t j = 0; j < uavs.size(); j++)
+        {
+            // Same test as the fitness function: 2 * distance * energy_per_km <= total_energy
+            auto end = partition_point(byDistance.begin(), byDistance.end(), [&](int o)
+                                       { return 2 * distance[o] * uavs[j].energy_per_km <= uavs[j].total_energy; });
+            reach[j] = end - byDistance.begin();
+        }
+        uavOrder.resize(uavs.size());
+        iota(uavOrder.begin(), uavOrder.end(), 0);
+        stable_sort(uavOrder.begin(), uavOrder.end(), [&](int a, int b)
+                    { return reach[a] < reach[b]; });
+    }
+};
+
+// v7 greedy: outposts by descending priority, each taken by the first free UAV
+// that can reach it. With `randomize`, ties in priority and the UAV scan order
+// are shuffled, giving different good seeds.
+void greedySeed(Particle &p, const vector<UAV> &uavs, const vector<Outpost> &outposts, const FeasibleSet &fs,
+                Xoshiro256 &rng, bool randomize)
+{
+    vector<int> order(outposts.size()), uavScan(uavs.size());
+    iota(order.begin(), order.end(), 0);
+    iota(uavScan.begin(), uavScan.end(), 0);
+    if (randomize)
+    {
+        for (size_t i = order.size(); i > 1; i--)
+            swap(order[i - 1], order[rng.bounded(i)]);
+        for (size_t i = uavScan.size(); i > 1; i--)
+            swap(uavScan[i - 1], uavScan[rng.bounded(i)]);
+    }
+    stable_sort(order.begin(), order.end(), [&](int a, int b)
+                { return outposts[a].priority > outposts[b].priority; });
+
+    // rank[o]: position of outpost o in distance order, to test reach in O(1)
+    vector<int> rank(outposts.size());
+    for (size_t k = 0; k < fs.byDistance.size(); k++)
+        rank[fs.byDistance[k]] = k;
+
+    fill(p.assignment.begin(), p.assignment.end(), -1);
+    size_t freeUAVs = uavs.size();
+    for (int o : order)
+    {
+        if (freeUAVs == 0)
+            break;
+        for (int j : uavScan)
+        {
+            if (p.assignment[j] == -1 && rank[o] < fs.reach[j])
+            {
+                p.assignment[j] = o;
+                freeUAVs--;
+                break;
+            }
+        }
+    }
+}
+
+// Partial Fisher-Yates over the feasible set. UAVs are visited from the
+// shortest reach up, so the pool of candidates only grows: outposts enter as
+// the reach increases, a draw swaps the pick to the end and pops it. Each
+// draw is O(1) and uniform over the outposts still free and reachable.
+void fisherYatesSeed(Particle &p, const FeasibleSet &fs, Xoshiro256 &rng)
+{
+    vector<int> pool;
+    size_t admitted = 0;
+    for (int j : fs.uavOrder)
+    {
+        while (admitted < (size_t)fs.reach[j])
+            pool.push_back(fs.byDistance[admitted++]);
+        if (pool.empty())
+        {
+            p.assignment[j] = -1;
+            continue;
+        }
+        size_t k = rng.bounded(pool.size());
+        p.assignment[j] = pool[k];
+        pool[k] = pool.back();
+        pool.pop_back();
+    }
+}
+
+// Latin hypercube over the swarm: for each UAV the particles are spread over
+// `count` equal strata of its feasible prefix (one particle per stratum, in a
+// random order), so together they cover near and far outposts evenly.
+// Collisions inside a particle move to the next free outpost in the prefix.
+void latinHypercubeSeeds(vector<Particle> &particles, size_t first, const FeasibleSet &fs, size_t numOutposts,
+                         Xoshiro256 &rng)
+{
+    size_t count = particles.size() - first;
+    if (count == 0)
+        return;
+    size_t numUAVs = fs.reach.size();
+    vector<int> strata(count);
+    vector<vector<int>> pick(count, vector<int>(numUAVs));
+    for (size_t j = 0; j < numUAVs; j++)
+    {
+        iota(strata.begin(), strata.end(), 0);
+        for (size_t i = count; i > 1; i--)
+            swap(strata[i - 1], strata[rng.bounded(i)]);
+        for (size_t i = 0; i < count; i++)
+            pick[i][j] = (int)((strata[i] + rng.uniform()) / count * fs.reach[j]);
+    }
+
+    vector<int> used(numOutposts, -1);
+    for (size_t i = 0; i < count; i++)
+    {
+        Particle &p = particles[first + i];
+        for (int j : fs.uavOrder)
+        {
+            p.assignment[j] = -1;
+            for (int probe = 0; probe < fs.reach[j]; probe++)
+            {
+                int o = fs.byDistance[(pick[i][j] + probe) % fs.reach[j]];
+                if (used[o] != (int)i)
+                {
+                    used[o] = i;
+                    p.assignment[j] = o;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Fills the swarm: the first greedyShare of the particles come from the greedy
+// (particle 0 is the plain v7 result), the rest from Fisher-Yates or LHS.
+void initializeParticles(vector<Particle> &particles, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                         const FeasibleSet &fs, double greedyShare, const string &sampler, Xoshiro256 &rng)
+{
+    size_t greedyCount = min(particles.size(), (size_t)ceil(greedyShare * particles.size()));
+    for (size_t i = 0; i < greedyCount; i++)
+        greedySeed(particles[i], uavs, outposts, fs, rng, i > 0);
+
+    if (sampler == "lhs")
+        latinHypercubeSeeds(particles, greedyCount, fs, outposts.size(), rng);
+    else
+        for (size_t i = greedyCount; i < particles.size(); i++)
+            fisherYatesSeed(particles[i], fs, rng);
+}
+
+// Particle Swarm Optimization Algorithm. The v5 update redrew genes at random,
+// which throws the starting swarm away; here each gene is copied from the
+// personal or global best (v6 rule), with a small chance of a fresh feasible
+// outpost. Returns the iteration where `target` was first reached (-1 if never).
+Particle PSO(int numParticles, int numIterations, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+             const BaseStation &base, double greedyShare, const string &sampler, double target, Xoshiro256 &rng,
+             double &initialBest, int &targetIteration)
+{
+    FeasibleSet fs(uavs, outposts, base);
+    vector<Particle> particles(numParticles, Particle(uavs.size()));
+    initializeParticles(particles, uavs, outposts, fs, greedyShare, sampler, rng);
+
+    Particle globalBest = particles[0];
+    targetIteration = -1;
+    for (int iter = 0; iter <= numIterations; iter++)
+    {
+        for (Particle &p : particles)
+        {
+            p.fitness = fitnessFunction(p, uavs, outposts, base);
+            if (p.fitness < p.best_fitness)
+            {
+                p.best_fitness = p.fitness;
+                p.best_assignment = p.assignment;
+            }
+            if (p.fitness < globalBest.fitness)
+            {
+                globalBest = p;
+            }
+        }
+        if (iter == 0)
+            initialBest = globalBest.fitness;
+        if (targetIteration < 0 && globalBest.fitness <= target)
+            targetIteration = iter;
+        if (iter == numIterations)
+            break;
+
+        for (Particle &p : particles)
+        {
+            for (size_t j = 0; j < p.assignment.size(); j++)
+            {
+                if (rng.uniform() < 0.02 && fs.reach[j] > 0)
+                    p.assignment[j] = fs.byDistance[rng.bounded(fs.reach[j])];
+                else
+                    p.assignment[j] = (rng.next() & 1) ? p.best_assignment[j] : globalBest.assignment[j];
+            }
+        }
+    }
+
+    return globalBest;
+}
+
+// Main Function
+int main(int argc, char **argv)
+{
+    // Options: --particles=N  --iterations=I  --greedy-share=F  --sampler=fy|lhs  --target=C  --seed=S
+    int numParticles = 30, numIterations = 100;
+    double greedyShare = 0.2;
+    string sampler = "fy";
+    double target = -numeric_limits<double>::max();
+    uint64_t seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--particles=", 0) == 0)
+            numParticles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            numIterations = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--greedy-share=", 0) == 0)
+            greedyShare = min(1.0, max(0.0, stod(arg.substr(15))));
+        else if (arg.rfind("--sampler=", 0) == 0)
+            sampler = arg.substr(10);
+        else if (arg.rfind("--target=", 0) == 0)
+            target = stod(arg.substr(9));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoull(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (sampler != "fy" && sampler != "lhs")
+    {
+        cerr << "Unknown sampler: " << sampler << " (expected fy or lhs)\n";
+        return 1;
+    }
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):" << endl;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weight_capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority):" << endl;
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    BaseStation base;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> base.x >> base.y;
+
+    Xoshiro256 rng(seed);
+    double initialBest;
+    int targetIteration;
+    Particle bestSolution = PSO(numParticles, numIterations, uavs, outposts, base, greedyShare, sampler, target, rng,
+                                initialBest, targetIteration);
+
+    cout << "\nBest UAV Allocation:\n";
+    for (size_t i = 0; i < bestSolution.assignment.size(); i++)
+    {
+        if (bestSolution.assignment[i] == -1)
+            cout << "UAV " << uavs[i].id << " not assigned\n";
+        else
+            cout << "UAV " << uavs[i].id << " assigned to Outpost " << outposts[bestSolution.assignment[i]].id << "\n";
+    }
+
+    cout << "Best Energy Cost: " << bestSolution.fitness << "\n";
+    cout << "Initial Swarm Best: " << initialBest << "\n";
+    if (target > -numeric_limits<double>::max())
+    {
+        if (targetIteration >= 0)
+            cout << "Target " << target << " reached at iteration " << targetIteration << "\n";
+        else
+            cout << "Target " << target << " not reached\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,461 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <chrono>
+#include <string>
+
+using namespace std;
+
+// Costs are integers for the simplex: energy per unit delivered x COST_SCALE
+const double COST_SCALE = 1000.0;
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// ---------------------------------------------------------------------------
+// Primal network simplex for min-cost flow with integer capacities and costs.
+//
+// - Every original arc has a residual twin (arc ^ 1). Flow on arc 2i is the
+//   residual capacity of 2i+1.
+// - Starts from an artificial root joined to every node (big-M cost), which
+//   is a strongly feasible spanning tree.
+// - Entering arc: block search. Arc pairs are scanned in blocks of about
+//   sqrt(arcs) and the most negative reduced cost of the block enters.
+// - Leaving arc: last bottleneck arc on the cycle, walked from the apex in cycle
+//   direction. This keeps the tree strongly feasible, so degenerate pivots
+//   cannot cycle.
+// - After a pivot only the subtree that moved gets new depths and potentials.
+// ---------------------------------------------------------------------------
+
+class NetworkSimplex
+{
+public:
+    explicit NetworkSimplex(int nodes) : n(nodes), supply(nodes, 0) {}
+
+    int addArc(int from, int to, long long capacity, long long cost)
+    {
+        head.push_back(to), tail.push_back(from), cap.push_back(capacity), cost_.push_back(cost);
+        head.push_back(from), tail.push_back(to), cap.push_back(0), cost_.push_back(-cost);
+        return (int)head.size() / 2 - 1;
+    }
+
+    void setSupply(int node, long long amount) { supply[node] = amount; }
+
+    // Returns false when the supplies cannot be routed
+    bool solve()
+    {
+        originalArcs = head.size();
+        int root = n;
+        long long maxCost = 1;
+        for (size_t e = 0; e < originalArcs; e += 2)
+            maxCost = max(maxCost, llabs(cost_[e]));
+        long long artificialCost = (maxCost + 1) * (n + 1);
+        long long infinite = 0;
+        for (long long s : supply)
+            infinite += llabs(s);
+        infinite = max(1LL, infinite);
+
+        parentArc.assign(n + 1, -1);
+        depth.assign(n + 1, 0);
+        potential.assign(n + 1, 0);
+        treeAdj.assign(n + 1, {});
+        adjPos.assign(head.size() + 2 * n, -1);
+
+        // Artificial tree: arcs oriented towards the root carry the node's
+        // supply; demand nodes are fed from the root.
+        for (int v = 0; v < n; v++)
+        {
+            int e;
+            if (supply[v] >= 0)
+            {
+                e = pushArc(v, root, infinite + supply[v], artificialCost);
+                cap[e] -= supply[v], cap[e ^ 1] += supply[v];
+                parentArc[v] = e ^ 1; // root -> v
+            }
+            else
+            {
+                e = pushArc(root, v, infinite - supply[v], artificialCost);
+                cap[e] += supply[v], cap[e ^ 1] -= supply[v];
+                parentArc[v] = e;
+            }
+            depth[v] = 1;
+            potential[v] = cost_[parentArc[v]];
+            link(e);
+        }
+
+        // Block search over arc pairs. The reverse arc has the negated reduced
+        // cost, so one potential lookup covers both directions.
+        size_t arcPairs = head.size() / 2;
+        size_t block = max<size_t>(10, (size_t)sqrt((double)arcPairs));
+        size_t next = 0;
+        while (true)
+        {
+            int entering = -1;
+            long long bestReduced = 0;
+            size_t scanned = 0, inBlock = 0;
+            while (scanned < arcPairs)
+            {
+                int e = 2 * next;
+                next = next + 1 == arcPairs ? 0 : next + 1;
+                scanned++;
+                long long reduced = cost_[e] + potential[tail[e]] - potential[head[e]];
+                if (reduced < bestReduced && cap[e] > 0)
+                    bestReduced = reduced, entering = e;
+                else if (-reduced < bestReduced && cap[e ^ 1] > 0)
+                    bestReduced = -reduced, entering = e ^ 1;
+                if (++inBlock == block)
+                {
+                    if (entering >= 0)
+                        break;
+                    inBlock = 0;
+                }
+            }
+            if (entering < 0)
+                break;
+            pivot(entering);
+            pivots++;
+        }
+
+        for (size_t e = originalArcs; e < head.size(); e += 2)
+            if (cap[e ^ 1] > 0)
+                return false; // Flow left on an artificial arc
+        return true;
+    }
+
+    long long flow(int arc) const { return cap[2 * arc + 1]; }
+    long long pivotCount() const { return pivots; }
+
+private:
+    int n;
+    vector<long long> supply;
+    vector<int> head, tail;
+    vector<long long> cap, cost_;
+    size_t originalArcs = 0;
+
+    vector<int> parentArc; // Arc from parent to node (residual direction)
+    vector<int> depth;
+    vector<long long> potential;
+    vector<vector<int>> treeAdj; // Tree arcs (even index of the pair) per node
+    vector<int> adjPos;          // adjPos[e], adjPos[e^1]: slot in tail/head list
+    long long pivots = 0;
+
+    int pushArc(int from, int to, long long capacity, long long cost)
+    {
+        head.push_back(to), tail.push_back(from), cap.push_back(capacity), cost_.push_back(cost);
+        head.push_back(from), tail.push_back(to), cap.push_back(0), cost_.push_back(-cost);
+        return (int)head.size() - 2;
+    }
+
+    void link(int e)
+    {
+        e &= ~1;
+        adjPos[e] = treeAdj[tail[e]].size(), treeAdj[tail[e]].push_back(e);
+        adjPos[e ^ 1] = treeAdj[head[e]].size(), treeAdj[head[e]].push_back(e);
+    }
+
+    void unlinkFrom(int node, int slot)
+    {
+        vector<int> &list = treeAdj[node];
+        int moved = list.back();
+        list[slot] = moved;
+        adjPos[tail[moved] == node ? moved : moved ^ 1] = slot;
+        list.pop_back();
+    }
+
+    void unlink(int e)
+    {
+        e &= ~1;
+        unlinkFrom(tail[e], adjPos[e]);
+        unlinkFrom(head[e], adjPos[e ^ 1]);
+    }
+
+    void pivot(int entering)
+    {
+        int a = tail[entering], b = head[entering];
+
+        // Apex of the cycle
+        int u = a, v = b;
+        while (u != v)
+        {
+            if (depth[u] >= depth[v])
+                u = tail[parentArc[u]];
+            else
+                v = tail[parentArc[v]];
+        }
+        int apex = u;
+
+        // Cycle in its own direction: apex -> ... -> a, entering, b -> ... -> apex.
+        // Collect the arcs in that order and keep the last bottleneck.
+        cycle.clear();
+        for (int w = a; w != apex; w = tail[parentArc[w]])
+            cycle.push_back(parentArc[w]); // Parent -> child, collected bottom-up
+        reverse(cycle.begin(), cycle.end());
+        int enteringPos = cycle.size();
+        cycle.push_back(entering);
+        for (int w = b; w != apex; w = tail[parentArc[w]])
+            cycle.push_back(parentArc[w] ^ 1); // Child -> parent
+
+        long long delta = numeric_limits<long long>::max();
+        int leavingPos = 0;
+        for (size_t i = 0; i < cycle.size(); i++)
+        {
+            if (cap[cycle[i]] <= delta)
+                delta = cap[cycle[i]], leavingPos = i;
+        }
+        if (delta > 0)
+            for (int e : cycle)
+                cap[e] -= delta, cap[e ^ 1] += delta;
+
+        if (leavingPos == enteringPos)
+            return;
+
+        // The leaving arc cuts off a subtree holding a (leaving arc on the
+        // apex..a side) or b. That subtree is re-hung from the entering arc.
+        int leaving = cycle[leavingPos];
+        bool onASide = leavingPos < enteringPos;
+        int newChild = onASide ? a : b;
+        unlink(leaving);
+        link(entering);
+        parentArc[newChild] = onASide ? entering ^ 1 : entering; // New parent -> newChild
+
+        // Walk the moved subtree: parent arcs, depths and potentials
+        stack.clear();
+        stack.push_back(newChild);
+        while (!stack.empty())
+        {
+            int x = stack.back();
+            stack.pop_back();
+            int p = tail[parentArc[x]];
+            depth[x] = depth[p] + 1;
+            potential[x] = potential[p] + cost_[parentArc[x]];
+            for (int e : treeAdj[x])
+            {
+                if (e == (parentArc[x] & ~1))
+                    continue;
+                parentArc[tail[e] == x ? head[e] : tail[e]] = tail[e] == x ? e : e ^ 1; // x -> child
+                stack.push_back(tail[e] == x ? head[e] : tail[e]);
+            }
+        }
+    }
+
+    vector<int> cycle, stack;
+};
+
+// Per-commodity delivery of one UAV to one outpost
+struct Delivery
+{
+    int uavIndex, outpostIndex;
+    int medicine, food, weapons;
+};
+
+int main(int argc, char **argv)
+{
+    // Options: --sorties=K  --quiet
+    int sorties = 1;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--sorties=", 0) == 0)
+            sorties = max(1, stoi(arg.substr(10)));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    auto start = chrono::steady_clock::now();
+
+    // Network: base (0) -> UAV sorties (1..m) -> outposts (m+1..m+n).
+    // The three commodities share UAV capacity and arcs, so they travel as one
+    // aggregate demand and are split per commodity afterwards. Each outpost
+    // also has an "unmet" arc from the base whose cost grows with priority and
+    // beats any real delivery, so the flow is always feasible.
+    int base = 0;
+    auto uavNode = [&](int i)
+    { return 1 + i; };
+    auto outpostNode = [&](int j)
+    { return 1 + numUAVs + j; };
+    NetworkSimplex ns(1 + numUAVs + numOutposts);
+
+    vector<long long> demand(numOutposts);
+    long long totalDemand = 0;
+    for (int j = 0; j < numOutposts; j++)
+    {
+        demand[j] = max(0, outposts[j].medicine) + max(0, outposts[j].food) + max(0, outposts[j].weapons);
+        totalDemand += demand[j];
+        ns.setSupply(outpostNode(j), -demand[j]);
+    }
+    ns.setSupply(base, totalDemand);
+
+    vector<long long> uavCapacity(numUAVs);
+    for (int i = 0; i < numUAVs; i++)
+    {
+        uavCapacity[i] = (long long)floor(uavs[i].weightCapacity) * sorties;
+        ns.addArc(base, uavNode(i), uavCapacity[i], 0);
+    }
+
+    // Delivery arcs: energy of a full round trip spread over a full load
+    struct DeliveryArc
+    {
+        int arc, uavIndex, outpostIndex;
+        double tripEnergy;
+    };
+    vector<DeliveryArc> deliveryArcs;
+    long long maxUnitCost = 0;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        if (uavs[i].weightCapacity < 1)
+            continue;
+        for (int j = 0; j < numOutposts; j++)
+        {
+            if (demand[j] == 0)
+                continue;
+            double distance = calculateDistance(baseX, baseY, outposts[j].x, outposts[j].y);
+            double tripEnergy = distance * uavs[i].energyPerKm * 2; // Round trip
+            if (tripEnergy > uavs[i].totalEnergy)
+                continue;
+            long long unitCost = llround(tripEnergy / floor(uavs[i].weightCapacity) * COST_SCALE);
+            maxUnitCost = max(maxUnitCost, unitCost);
+            int arc = ns.addArc(uavNode(i), outpostNode(j), min(uavCapacity[i], demand[j]), unitCost);
+            deliveryArcs.push_back({arc, i, j, tripEnergy});
+        }
+    }
+    vector<int> unmetArc(numOutposts);
+    for (int j = 0; j < numOutposts; j++)
+        unmetArc[j] = ns.addArc(base, outpostNode(j), demand[j], (maxUnitCost + 1) * max(1, outposts[j].priority));
+
+    bool ok = ns.solve();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (!ok)
+    {
+        cerr << "Flow network is infeasible\n";
+        return 1;
+    }
+
+    // Split each outpost's aggregate inflow into medicine, food, weapons,
+    // filling commodities in that order across the UAVs that serve it
+    vector<int> leftMedicine(numOutposts), leftFood(numOutposts), leftWeapons(numOutposts);
+    for (int j = 0; j < numOutposts; j++)
+    {
+        long long unmet = ns.flow(unmetArc[j]);
+        // Unmet units come off the back: weapons, then food, then medicine
+        int w = max(0, outposts[j].weapons), f = max(0, outposts[j].food), m = max(0, outposts[j].medicine);
+        long long cut = min<long long>(unmet, w);
+        w -= cut, unmet -= cut;
+        cut = min<long long>(unmet, f);
+        f -= cut, unmet -= cut;
+        m -= unmet;
+        leftMedicine[j] = m, leftFood[j] = f, leftWeapons[j] = w;
+    }
+
+    vector<Delivery> deliveries;
+    vector<double> sortiesUsed(numUAVs, 0), wholeSorties(numUAVs, 0);
+    double fractionalEnergy = 0, wholeTripEnergy = 0;
+    long long delivered = 0;
+    for (const auto &d : deliveryArcs)
+    {
+        long long load = ns.flow(d.arc);
+        if (load == 0)
+            continue;
+        int j = d.outpostIndex;
+        Delivery del{d.uavIndex, j, 0, 0, 0};
+        long long rest = load;
+        del.medicine = min<long long>(rest, leftMedicine[j]), rest -= del.medicine, leftMedicine[j] -= del.medicine;
+        del.food = min<long long>(rest, leftFood[j]), rest -= del.food, leftFood[j] -= del.food;
+        del.weapons = min<long long>(rest, leftWeapons[j]), rest -= del.weapons, leftWeapons[j] -= del.weapons;
+        deliveries.push_back(del);
+
+        double capacity = floor(uavs[d.uavIndex].weightCapacity);
+        sortiesUsed[d.uavIndex] += load / capacity;
+        wholeSorties[d.uavIndex] += ceil(load / capacity);
+        fractionalEnergy += load / capacity * d.tripEnergy;
+        wholeTripEnergy += ceil(load / capacity) * d.tripEnergy;
+        delivered += load;
+    }
+
+    if (!quiet)
+    {
+        cout << "\nDelivery Plan:\n";
+        for (const auto &d : deliveries)
+        {
+            cout << "UAV " << uavs[d.uavIndex].id << " -> Outpost " << outposts[d.outpostIndex].id
+                 << " | Medicine: " << d.medicine << " | Food: " << d.food << " | Weapons: " << d.weapons << "\n";
+        }
+    }
+
+    long long unmetPriority = 0;
+    int partlyUnmet = 0;
+    for (int j = 0; j < numOutposts; j++)
+    {
+        long long unmet = ns.flow(unmetArc[j]);
+        if (unmet > 0)
+        {
+            partlyUnmet++;
+            unmetPriority += unmet * outposts[j].priority;
+        }
+    }
+    int overBudget = 0;
+    for (int i = 0; i < numUAVs; i++)
+        if (wholeSorties[i] > sorties)
+            overBudget++;
+
+    cout << "\nDelivered: " << delivered << "/" << totalDemand << " units | Outposts short: " << partlyUnmet
+         << " | Unmet priority-units: " << unmetPriority << "\n";
+    cout << "Energy (fractional sorties): " << fractionalEnergy << " | Energy (whole sorties): " << wholeTripEnergy << "\n";
+    cout << "UAVs needing more than " << sorties << " whole sorties: " << overBudget << "\n";
+    cout << "Arcs: " << deliveryArcs.size() << " delivery | Pivots: " << ns.pivotCount() << " | Solve: " << seconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,579 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <string>
+
+using namespace std;
+
+const double INF = numeric_limits<double>::infinity();
+const int DEFAULT_GRID_CELLS = 512; // Cells along the longer side when --cell is not given
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    double availableTime; // Time when UAV is available again
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time; // Min-heap based on time
+    }
+};
+
+struct Point
+{
+    double x, y;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// ---------------------------------------------------------------------------
+// Raster grid and no-fly layer. A cell is blocked while at least one zone
+// covers its centre; per-cell counters let zones overlap and be removed in any
+// order.
+// ---------------------------------------------------------------------------
+
+struct Grid
+{
+    double minX, minY, cell;
+    int width, height;
+
+    int index(double x, double y) const
+    {
+        int cx = min(width - 1, max(0, (int)((x - minX) / cell)));
+        int cy = min(height - 1, max(0, (int)((y - minY) / cell)));
+        return cy * width + cx;
+    }
+    Point center(int c) const { return {minX + (c % width + 0.5) * cell, minY + (c / width + 0.5) * cell}; }
+    int size() const { return width * height; }
+};
+
+class NoFlyLayer
+{
+public:
+    explicit NoFlyLayer(const Grid &g) : grid(g), blockCount(g.size(), 0) {}
+
+    bool blocked(int c) const { return blockCount[c] > 0; }
+
+    // Rasterises the polygon (even-odd rule at cell centres) and returns the
+    // cells that just became blocked
+    int addZone(const vector<Point> &polygon, vector<int> &newlyBlocked)
+    {
+        vector<int> cells = rasterize(polygon);
+        newlyBlocked.clear();
+        for (int c : cells)
+            if (blockCount[c]++ == 0)
+                newlyBlocked.push_back(c);
+        zones.push_back(move(cells));
+        return zones.size() - 1;
+    }
+
+    // Returns false for an unknown or already removed zone
+    bool removeZone(int zone, vector<int> &newlyFreed)
+    {
+        newlyFreed.clear();
+        if (zone < 0 || zone >= (int)zones.size() || removed(zone))
+            return false;
+        for (int c : zones[zone])
+            if (--blockCount[c] == 0)
+                newlyFreed.push_back(c);
+        zones[zone] = {-1}; // Tombstone
+        return true;
+    }
+
+    bool removed(int zone) const { return zones[zone].size() == 1 && zones[zone][0] == -1; }
+
+private:
+    const Grid &grid;
+    vector<int> blockCount;
+    vector<vector<int>> zones; // Cells covered by each zone
+
+    vector<int> rasterize(const vector<Point> &polygon) const
+    {
+        vector<int> cells;
+        if (polygon.size() < 3)
+            return cells;
+        double lo = polygon[0].y, hi = polygon[0].y;
+        for (const auto &p : polygon)
+            lo = min(lo, p.y), hi = max(hi, p.y);
+        int row0 = max(0, (int)floor((lo - grid.minY) / grid.cell - 0.5));
+        int row1 = min(grid.height - 1, (int)ceil((hi - grid.minY) / grid.cell - 0.5));
+
+        vector<double> crossings;
+        for (int row = row0; row <= row1; row++)
+        {
+            double y = grid.minY + (row + 0.5) * grid.cell;
+            crossings.clear();
+            for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++)
+            {
+                const Point &a = polygon[i], &b = polygon[j];
+                if ((a.y <= y) != (b.y <= y))
+                    crossings.push_back(a.x + (y - a.y) / (b.y - a.y) * (b.x - a.x));
+            }
+            sort(crossings.begin(), crossings.end());
+            for (size_t k = 0; k + 1 < crossings.size(); k += 2)
+            {
+                // Columns whose centre lies in [left, right)
+                int col0 = max(0, (int)ceil((crossings[k] - grid.minX) / grid.cell - 0.5));
+                int col1 = min(grid.width - 1, (int)ceil((crossings[k + 1] - grid.minX) / grid.cell - 0.5) - 1);
+                for (int col = col0; col <= col1; col++)
+                    cells.push_back(row * grid.width + col);
+            }
+        }
+        return cells;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Distance field: shortest flight distance from the base to every cell on the
+// 8-connected grid (no corner cutting past blocked cells), from a
+// multi-source Dijkstra seeded at the cells around the base. Keeps the
+// shortest-path tree so zone changes are repaired locally:
+//   - zone added: cells whose tree path runs through a newly blocked cell (or
+//     a diagonal it now cuts) are reset and re-settled from their boundary;
+//   - zone removed: freed cells are relaxed from their neighbours and the
+//     decreases propagate outwards.
+// Path cost to an outpost is then an O(1) lookup.
+// ---------------------------------------------------------------------------
+
+class DistanceField
+{
+public:
+    DistanceField(const Grid &g, const NoFlyLayer &layer, Point source)
+        : grid(g), zones(layer), base(source), dist(g.size(), INF), parent(g.size(), -1) {}
+
+    void build()
+    {
+        fill(dist.begin(), dist.end(), INF);
+        fill(parent.begin(), parent.end(), -1);
+        seedSources();
+        settle();
+    }
+
+    void onBlocked(const vector<int> &newlyBlocked)
+    {
+        // Roots of invalid subtrees: the blocked cells and any neighbour whose
+        // parent move now cuts a blocked corner
+        vector<int> invalid;
+        int b = grid.index(base.x, base.y);
+        for (int c : newlyBlocked)
+        {
+            invalidate(c, invalid);
+            if (c == b)
+            {
+                // Base cell closed: every source loses its seed
+                forNeighbours(b, [&](int y, double)
+                              {
+                    if (parent[y] == -1)
+                        invalidate(y, invalid); });
+            }
+            forNeighbours(c, [&](int y, double)
+                          {
+                if (parent[y] >= 0 && !moveAllowed(parent[y], y))
+                    invalidate(y, invalid); });
+        }
+        // Whole subtrees below the roots
+        for (size_t k = 0; k < invalid.size(); k++)
+        {
+            int x = invalid[k];
+            forNeighbours(x, [&](int y, double)
+                          {
+                if (parent[y] == x)
+                    invalidate(y, invalid); });
+        }
+        // Re-settle the invalid region from its valid boundary
+        for (int x : invalid)
+        {
+            if (zones.blocked(x))
+                continue;
+            if (isSource(x))
+                relaxFromBase(x);
+            forNeighbours(x, [&](int y, double w)
+                          {
+                if (dist[y] + w < dist[x] && moveAllowed(y, x))
+                    dist[x] = dist[y] + w, parent[x] = y; });
+            if (dist[x] < INF)
+                heap.push({dist[x], x});
+        }
+        settle();
+        lastTouched = invalid.size();
+    }
+
+    void onFreed(const vector<int> &newlyFreed)
+    {
+        // A freed cell can be entered, and it also reopens diagonals around it
+        lastTouched = 0;
+        int b = grid.index(base.x, base.y);
+        for (int c : newlyFreed)
+        {
+            if (c == b)
+                seedSources(); // Base cell reopened: all sources seed again
+            if (isSource(c))
+                relaxFromBase(c);
+            forNeighbours(c, [&](int y, double w)
+                          {
+                if (dist[y] + w < dist[c] && moveAllowed(y, c))
+                    dist[c] = dist[y] + w, parent[c] = y; });
+            if (dist[c] < INF)
+                heap.push({dist[c], c});
+            forNeighbours(c, [&](int y, double)
+                          {
+                if (dist[y] < INF)
+                    heap.push({dist[y], y}); });
+        }
+        settle();
+    }
+
+    // Flight distance from the base to (x, y); INF when unreachable
+    double pathDistance(double x, double y) const
+    {
+        int c = grid.index(x, y);
+        if (dist[c] == INF)
+            return INF;
+        Point p = grid.center(c);
+        return dist[c] + calculateDistance(p.x, p.y, x, y);
+    }
+
+    size_t touchedCells() const { return lastTouched; }
+
+private:
+    const Grid &grid;
+    const NoFlyLayer &zones;
+    Point base;
+    vector<double> dist;
+    vector<int> parent; // -1 for sources and unreached cells
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> heap;
+    size_t lastTouched = 0;
+
+    template <typename Visit>
+    void forNeighbours(int c, Visit visit) const
+    {
+        static const double diagonal = sqrt(2.0);
+        int cx = c % grid.width, cy = c / grid.width;
+        for (int dy = -1; dy <= 1; dy++)
+        {
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                int nx = cx + dx, ny = cy + dy;
+                if ((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= grid.width || ny >= grid.height)
+                    continue;
+                visit(ny * grid.width + nx, (dx != 0 && dy != 0 ? diagonal : 1.0) * grid.cell);
+            }
+        }
+    }
+
+    // Both cells free, and a diagonal may not squeeze past a blocked cell
+    bool moveAllowed(int from, int to) const
+    {
+        if (zones.blocked(from) || zones.blocked(to))
+            return false;
+        int fx = from % grid.width, fy = from / grid.width, tx = to % grid.width, ty = to / grid.width;
+        if (fx != tx && fy != ty)
+            return !zones.blocked(fy * grid.width + tx) && !zones.blocked(ty * grid.width + fx);
+        return true;
+    }
+
+    // Sources: the base cell and its neighbours, at their straight-line distance
+    bool isSource(int c) const
+    {
+        int b = grid.index(base.x, base.y);
+        return abs(c % grid.width - b % grid.width) <= 1 && abs(c / grid.width - b / grid.width) <= 1;
+    }
+
+    void relaxFromBase(int c)
+    {
+        if (zones.blocked(c) || zones.blocked(grid.index(base.x, base.y)))
+            return;
+        Point p = grid.center(c);
+        double d = calculateDistance(base.x, base.y, p.x, p.y);
+        if (d < dist[c])
+            dist[c] = d, parent[c] = -1;
+    }
+
+    void seedSources()
+    {
+        int b = grid.index(base.x, base.y);
+        relaxFromBase(b);
+        if (dist[b] < INF)
+            heap.push({dist[b], b});
+        forNeighbours(b, [&](int y, double)
+                      {
+            relaxFromBase(y);
+            if (dist[y] < INF)
+                heap.push({dist[y], y}); });
+    }
+
+    void invalidate(int c, vector<int> &invalid)
+    {
+        if (dist[c] == INF && parent[c] == -1)
+            return; // Already reset (or never reached)
+        dist[c] = INF;
+        parent[c] = -1;
+        invalid.push_back(c);
+    }
+
+    void settle()
+    {
+        while (!heap.empty())
+        {
+            auto [d, x] = heap.top();
+            heap.pop();
+            if (d > dist[x])
+                continue; // Stale entry
+            forNeighbours(x, [&](int y, double w)
+                          {
+                if (d + w < dist[y] && moveAllowed(x, y))
+                {
+                    dist[y] = d + w;
+                    parent[y] = x;
+                    heap.push({dist[y], y});
+                    lastTouched++;
+                } });
+        }
+    }
+};
+
+// v8 scheduler with the straight-line distance replaced by the flight distance.
+// Prints one line per outpost unless quiet; returns (served, energy, makespan).
+struct ScheduleSummary
+{
+    int served = 0;
+    double energy = 0, makespan = 0, detour = 0;
+};
+
+ScheduleSummary schedule(vector<UAV> uavs, const vector<Outpost> &outposts, double baseX, double baseY,
+                         const DistanceField &field, bool quiet)
+{
+    priority_queue<Task, vector<Task>, greater<Task>> pq;
+    for (size_t i = 0; i < uavs.size(); i++)
+    {
+        uavs[i].availableTime = 0;
+        pq.push({0, (int)i}); // All UAVs start at time 0
+    }
+
+    ScheduleSummary summary;
+    vector<Task> tempUAVs; // Store popped elements to push them back later
+    for (const auto &outpost : outposts)
+    {
+        double straight = calculateDistance(baseX, baseY, outpost.x, outpost.y);
+        double distance = field.pathDistance(outpost.x, outpost.y);
+        int selectedUAV = -1;
+        double selectedEnergyUsed = 0, selectedTravelTime = 0;
+
+        tempUAVs.clear();
+        while (distance < INF && !pq.empty())
+        {
+            auto [availableTime, uavIndex] = pq.top();
+            pq.pop();
+            UAV &uav = uavs[uavIndex];
+
+            double energyCost = distance * uav.energyPerKm * 2; // Round trip along the same path
+            double travelTime = distance / 10.0;                // Assume 10 units speed
+
+            if (energyCost <= uav.totalEnergy)
+            {
+                selectedUAV = uavIndex;
+                selectedEnergyUsed = energyCost;
+                selectedTravelTime = travelTime;
+                uav.availableTime = availableTime + (2 * travelTime);
+                pq.push({uav.availableTime, uavIndex});
+                break;
+            }
+            tempUAVs.push_back({availableTime, uavIndex});
+        }
+        for (auto &task : tempUAVs)
+            pq.push(task);
+
+        if (selectedUAV >= 0)
+        {
+            summary.served++;
+            summary.energy += selectedEnergyUsed;
+            summary.makespan = max(summary.makespan, uavs[selectedUAV].availableTime);
+            summary.detour += distance - straight;
+            if (!quiet)
+                cout << "UAV " << uavs[selectedUAV].id << " assigned to Outpost " << outpost.id
+                     << " | Distance: " << distance << " (straight " << straight << ") | Energy Cost: " << selectedEnergyUsed
+                     << " | Travel Time: " << selectedTravelTime << " | Available Again At: " << uavs[selectedUAV].availableTime << "\n";
+        }
+        else if (!quiet)
+        {
+            if (distance == INF)
+                cout << "⚠️ Warning: Outpost " << outpost.id << " is cut off by no-fly zones.\n";
+            else
+                cout << "⚠️ Warning: Outpost " << outpost.id << " could not be reached due to UAV constraints.\n";
+        }
+    }
+    return summary;
+}
+
+vector<Point> readPolygon()
+{
+    int k;
+    cin >> k;
+    vector<Point> polygon(max(0, k));
+    for (auto &p : polygon)
+        cin >> p.x >> p.y;
+    return polygon;
+}
+
+void printSummary(const string &label, const ScheduleSummary &s, size_t outpostCount, double seconds, size_t touched)
+{
+    cout << label << ": served " << s.served << "/" << outpostCount << " | Total Energy: " << s.energy
+         << " | Makespan: " << s.makespan << " | Detour: " << s.detour << " | Field update: " << seconds * 1000
+         << " ms (" << touched << " cells)\n";
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --cell=SIZE  --quiet
+    double cellSize = 0;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--cell=", 0) == 0)
+            cellSize = stod(arg.substr(7));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+        uavs[i].availableTime = 0; // Initially all UAVs are available
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    int numZones;
+    cout << "Enter number of no-fly zones: ";
+    cin >> numZones;
+    vector<vector<Point>> polygons(max(0, numZones));
+    cout << "Enter each zone as: vertex count, then x y per vertex:\n";
+    for (auto &polygon : polygons)
+        polygon = readPolygon();
+
+    // Sort outposts by priority (descending)
+    sort(outposts.begin(), outposts.end(), [](const Outpost &a, const Outpost &b)
+         { return a.priority > b.priority; });
+
+    // Grid over base, outposts and initial zones, with a 5% margin
+    double lox = baseX, hix = baseX, loy = baseY, hiy = baseY;
+    auto extend = [&](double x, double y)
+    { lox = min(lox, x), hix = max(hix, x), loy = min(loy, y), hiy = max(hiy, y); };
+    for (const auto &o : outposts)
+        extend(o.x, o.y);
+    for (const auto &polygon : polygons)
+        for (const auto &p : polygon)
+            extend(p.x, p.y);
+    double span = max({hix - lox, hiy - loy, 1e-6});
+    lox -= 0.05 * span, loy -= 0.05 * span, hix += 0.05 * span, hiy += 0.05 * span;
+    span *= 1.1;
+    if (cellSize <= 0)
+        cellSize = span / DEFAULT_GRID_CELLS;
+    Grid grid{lox, loy, cellSize, (int)ceil((hix - lox) / cellSize) + 1, (int)ceil((hiy - loy) / cellSize) + 1};
+
+    NoFlyLayer layer(grid);
+    vector<int> changed;
+    for (const auto &polygon : polygons)
+        layer.addZone(polygon, changed);
+
+    auto start = chrono::steady_clock::now();
+    DistanceField field(grid, layer, {baseX, baseY});
+    field.build();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (!quiet)
+        cout << "\nBest UAV Allocation:\n";
+    ScheduleSummary summary = schedule(uavs, outposts, baseX, baseY, field, quiet);
+    cout << "\nGrid " << grid.width << "x" << grid.height << " (cell " << grid.cell << ")\n";
+    printSummary("Initial", summary, outposts.size(), seconds, grid.size());
+
+    // Zone updates: "add <vertex count> x y ..." or "remove <zone index>".
+    // Zones are numbered in the order they were added, starting at 0.
+    int numUpdates = 0;
+    cout << "Enter number of zone updates: ";
+    cin >> numUpdates;
+    for (int u = 0; u < numUpdates; u++)
+    {
+        string op;
+        cin >> op;
+        start = chrono::steady_clock::now();
+        string label;
+        if (op == "add")
+        {
+            int zone = layer.addZone(readPolygon(), changed);
+            field.onBlocked(changed);
+            label = "Add zone " + to_string(zone);
+        }
+        else if (op == "remove")
+        {
+            int zone;
+            cin >> zone;
+            if (!layer.removeZone(zone, changed))
+            {
+                cerr << "No active zone " << zone << "\n";
+                continue;
+            }
+            field.onFreed(changed);
+            label = "Remove zone " + to_string(zone);
+        }
+        else
+        {
+            cerr << "Unknown zone update: " << op << "\n";
+            return 1;
+        }
+        seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        printSummary(label, schedule(uavs, outposts, baseX, baseY, field, true), outposts.size(), seconds,
+                     field.touchedCells());
+    }
+
+    return 0;
+}
@@ -0,0 +1,536 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+using namespace std;
+
+const size_t DEFAULT_RING_CAPACITY = 1 << 16; // Messages; rounded up to a power of two
+const size_t DEFAULT_BATCH = 4096;            // Most messages drained per planning round
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy; // Current battery level
+    double x, y;        // Current position (starts at the base)
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+struct Allocation
+{
+    int uavId;
+    int outpostId;
+    double energyCost;
+};
+
+// v7 allocator, with energy measured from each UAV's current position
+vector<Allocation> allocateUAVs(const vector<UAV> &uavs, const vector<Outpost> &outposts)
+{
+    vector<Allocation> allocations;
+    vector<int> order(outposts.size());
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&](int a, int b)
+         { return outposts[a].priority > outposts[b].priority; }); // Sort outposts by priority
+
+    vector<bool> assignedUAVs(uavs.size(), false);
+    for (int i : order)
+    {
+        for (size_t j = 0; j < uavs.size(); j++)
+        {
+            if (assignedUAVs[j])
+                continue;
+            double distance = calculateDistance(uavs[j].x, uavs[j].y, outposts[i].x, outposts[i].y);
+            double energyCost = distance * uavs[j].energyPerKm;
+            if (energyCost <= uavs[j].totalEnergy)
+            { // Check if UAV has enough energy
+                allocations.push_back({uavs[j].id, outposts[i].id, energyCost});
+                assignedUAVs[j] = true;
+                break; // Assign one UAV per outpost
+            }
+        }
+    }
+    return allocations;
+}
+
+// ---------------------------------------------------------------------------
+// Telemetry messages and the lock-free ring they travel through.
+// ---------------------------------------------------------------------------
+
+enum class MessageKind : uint8_t
+{
+    UAV_STATE,      // Position and battery of a UAV
+    OUTPOST_DEMAND, // Demand and priority of an outpost
+};
+
+struct Telemetry
+{
+    MessageKind kind;
+    int id;
+    double a, b, c; // UAV: x, y, battery | outpost: medicine, food, weapons
+    int priority;   // Outposts only
+};
+
+// Text form shared by replay files and UDP datagrams (one message per line):
+//   uav <id> <x> <y> <battery>
+//   outpost <id> <medicine> <food> <weapons> <priority>
+bool parseTelemetry(const string &line, Telemetry &msg)
+{
+    // strtod/strtol instead of istringstream: parsing is the producers' main cost
+    const char *p = line.c_str();
+    while (*p == ' ' || *p == '\t')
+        p++;
+    int fields;
+    if (strncmp(p, "uav ", 4) == 0)
+        msg.kind = MessageKind::UAV_STATE, msg.priority = 0, fields = 4, p += 4;
+    else if (strncmp(p, "outpost ", 8) == 0)
+        msg.kind = MessageKind::OUTPOST_DEMAND, fields = 5, p += 8;
+    else
+        return false;
+
+    char *end;
+    msg.id = strtol(p, &end, 10);
+    if (end == p)
+        return false;
+    double *values[3] = {&msg.a, &msg.b, &msg.c};
+    for (int k = 0; k < 3; k++)
+    {
+        p = end;
+        *values[k] = strtod(p, &end);
+        if (end == p)
+            return false;
+    }
+    if (fields == 5)
+    {
+        p = end;
+        msg.priority = strtol(p, &end, 10);
+        if (end == p)
+            return false;
+    }
+    return true;
+}
+
+// Bounded multi-producer / single-consumer ring (Vyukov's sequence-number
+// design). Each slot carries a sequence number telling producers and the
+// consumer whose turn it is. Producers claim a position with one CAS, the
+// consumer never needs one, and nobody ever takes a lock.
+template <typename T>
+class MpscRing
+{
+public:
+    explicit MpscRing(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < max<size_t>(2, capacity))
+            size <<= 1;
+        mask = size - 1;
+        slots.reset(new Slot[size]);
+        for (size_t i = 0; i < size; i++)
+            slots[i].sequence.store(i, memory_order_relaxed);
+    }
+
+    // Any thread; false when the ring is full
+    bool tryPush(const T &value)
+    {
+        size_t pos = tail.load(memory_order_relaxed);
+        while (true)
+        {
+            Slot &slot = slots[pos & mask];
+            size_t seq = slot.sequence.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    slot.value = value;
+                    slot.sequence.store(pos + 1, memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false; // Full
+            else
+                pos = tail.load(memory_order_relaxed);
+        }
+    }
+
+    // Consumer thread only; false when empty
+    bool tryPop(T &value)
+    {
+        Slot &slot = slots[head & mask];
+        size_t seq = slot.sequence.load(memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(head + 1) < 0)
+            return false;
+        value = slot.value;
+        slot.sequence.store(head + mask + 1, memory_order_release);
+        head++;
+        return true;
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+private:
+    struct Slot
+    {
+        atomic<size_t> sequence;
+        T value;
+    };
+    unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) atomic<size_t> tail{0}; // Producers
+    alignas(64) size_t head = 0;        // Consumer
+};
+
+struct IngestStats
+{
+    atomic<long long> produced{0}, dropped{0}, malformed{0};
+};
+
+// Replays a file as fast as allowed (rate 0 = unlimited). A full ring makes the
+// replay wait, since a file can always be read later.
+void replayProducer(const string &path, double rate, MpscRing<Telemetry> &ring, IngestStats &stats,
+                    atomic<bool> &stop)
+{
+    ifstream file(path);
+    if (!file)
+    {
+        cerr << "Cannot open replay file: " << path << "\n";
+        return;
+    }
+    auto start = chrono::steady_clock::now();
+    long long sent = 0;
+    string line;
+    Telemetry msg;
+    while (!stop.load(memory_order_relaxed) && getline(file, line))
+    {
+        if (!parseTelemetry(line, msg))
+        {
+            if (!line.empty())
+                stats.malformed++;
+            continue;
+        }
+        if (rate > 0)
+            this_thread::sleep_until(start + chrono::duration<double>(sent / rate));
+        while (!ring.tryPush(msg))
+        {
+            if (stop.load(memory_order_relaxed))
+                return;
+            this_thread::yield();
+        }
+        sent++;
+        stats.produced++;
+    }
+}
+
+// Reads datagrams on a UDP port (one or more lines each) until stopped. A
+// socket cannot be paused, so a full ring drops the message and counts it.
+void udpProducer(int port, MpscRing<Telemetry> &ring, IngestStats &stats, atomic<bool> &stop)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        cerr << "Cannot open UDP socket\n";
+        return;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    timeval timeout{0, 100000}; // Wake up every 100 ms to check the stop flag
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        cerr << "Cannot bind UDP port " << port << "\n";
+        close(fd);
+        return;
+    }
+
+    char buffer[65536];
+    Telemetry msg;
+    while (!stop.load(memory_order_relaxed))
+    {
+        ssize_t n = recv(fd, buffer, sizeof(buffer) - 1, 0);
+        if (n <= 0)
+            continue;
+        buffer[n] = '\0';
+        istringstream lines(buffer);
+        string line;
+        while (getline(lines, line))
+        {
+            if (!parseTelemetry(line, msg))
+            {
+                if (!line.empty())
+                    stats.malformed++;
+                continue;
+            }
+            if (ring.tryPush(msg))
+                stats.produced++;
+            else
+                stats.dropped++;
+        }
+    }
+    close(fd);
+}
+
+// ---------------------------------------------------------------------------
+// Planner side: drain a batch, keep only the newest message per UAV and per
+// outpost, apply them to the arrays and replan.
+// ---------------------------------------------------------------------------
+
+class Coalescer
+{
+public:
+    Coalescer(const vector<UAV> &uavs, const vector<Outpost> &outposts)
+        : latestUAV(uavs.size()), latestOutpost(outposts.size()), uavSeen(uavs.size(), 0),
+          outpostSeen(outposts.size(), 0)
+    {
+        for (size_t i = 0; i < uavs.size(); i++)
+            uavIndex[uavs[i].id] = i;
+        for (size_t i = 0; i < outposts.size(); i++)
+            outpostIndex[outposts[i].id] = i;
+    }
+
+    // Returns the number of messages taken from the ring
+    size_t drain(MpscRing<Telemetry> &ring, size_t limit)
+    {
+        batch++;
+        touchedUAVs.clear();
+        touchedOutposts.clear();
+        Telemetry msg;
+        size_t taken = 0;
+        while (taken < limit && ring.tryPop(msg))
+        {
+            taken++;
+            if (msg.kind == MessageKind::UAV_STATE)
+                keep(msg, uavIndex, latestUAV, uavSeen, touchedUAVs);
+            else
+                keep(msg, outpostIndex, latestOutpost, outpostSeen, touchedOutposts);
+        }
+        return taken;
+    }
+
+    // Writes the kept messages into the arrays; returns how many were applied
+    size_t apply(vector<UAV> &uavs, vector<Outpost> &outposts) const
+    {
+        for (int i : touchedUAVs)
+        {
+            const Telemetry &m = latestUAV[i];
+            uavs[i].x = m.a, uavs[i].y = m.b, uavs[i].totalEnergy = m.c;
+        }
+        for (int i : touchedOutposts)
+        {
+            const Telemetry &m = latestOutpost[i];
+            outposts[i].medicine = (int)m.a, outposts[i].food = (int)m.b, outposts[i].weapons = (int)m.c;
+            outposts[i].priority = m.priority;
+        }
+        return touchedUAVs.size() + touchedOutposts.size();
+    }
+
+    size_t unknownIds() const { return unknown; }
+
+private:
+    unordered_map<int, int> uavIndex, outpostIndex;
+    vector<Telemetry> latestUAV, latestOutpost;
+    vector<long long> uavSeen, outpostSeen; // Batch that last touched the entry
+    vector<int> touchedUAVs, touchedOutposts;
+    long long batch = 0;
+    size_t unknown = 0; // Messages for ids not in the input, over all batches
+
+    void keep(const Telemetry &msg, const unordered_map<int, int> &index, vector<Telemetry> &latest,
+              vector<long long> &seen, vector<int> &touched)
+    {
+        auto it = index.find(msg.id);
+        if (it == index.end())
+        {
+            unknown++;
+            return;
+        }
+        int i = it->second;
+        if (seen[i] != batch)
+        {
+            seen[i] = batch;
+            touched.push_back(i);
+        }
+        latest[i] = msg; // Ring order is arrival order, so the last one wins
+    }
+};
+
+int main(int argc, char **argv)
+{
+    // Options: --replay=FILE (repeatable)  --rate=MSGS_PER_S  --udp=PORT  --duration=S
+    //          --ring=N  --batch=N  --interval=MS  --quiet
+    vector<string> replays;
+    double rate = 0, duration = 0;
+    int udpPort = 0, intervalMs = 10;
+    size_t ringCapacity = DEFAULT_RING_CAPACITY, batchLimit = DEFAULT_BATCH;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--replay=", 0) == 0)
+            replays.push_back(arg.substr(9));
+        else if (arg.rfind("--rate=", 0) == 0)
+            rate = stod(arg.substr(7));
+        else if (arg.rfind("--udp=", 0) == 0)
+            udpPort = stoi(arg.substr(6));
+        else if (arg.rfind("--duration=", 0) == 0)
+            duration = stod(arg.substr(11));
+        else if (arg.rfind("--ring=", 0) == 0)
+            ringCapacity = stoull(arg.substr(7));
+        else if (arg.rfind("--batch=", 0) == 0)
+            batchLimit = max<size_t>(1, stoull(arg.substr(8)));
+        else if (arg.rfind("--interval=", 0) == 0)
+            intervalMs = max(0, stoi(arg.substr(11)));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (replays.empty() && udpPort == 0)
+    {
+        cerr << "No telemetry source: give --replay=FILE and/or --udp=PORT\n";
+        return 1;
+    }
+    if (udpPort != 0 && duration <= 0)
+    {
+        cerr << "--udp needs --duration=S: a UDP source never finishes, so the run would never end\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+    for (auto &uav : uavs)
+        uav.x = baseX, uav.y = baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+    cout << "\n";
+
+    MpscRing<Telemetry> ring(ringCapacity);
+    IngestStats stats;
+    atomic<bool> stop{false};
+    atomic<int> replaysRunning{(int)replays.size()};
+    vector<thread> producers;
+    for (const auto &path : replays)
+        producers.emplace_back([&, path]
+                               {
+            replayProducer(path, rate, ring, stats, stop);
+            replaysRunning--; });
+    if (udpPort)
+        producers.emplace_back(udpProducer, udpPort, ref(ring), ref(stats), ref(stop));
+
+    // Planner loop: runs until the replays are done and the ring is empty,
+    // or until --duration runs out (required with --udp, checked above)
+    Coalescer coalescer(uavs, outposts);
+    auto start = chrono::steady_clock::now();
+    long long drained = 0, applied = 0, replans = 0;
+    size_t largestBatch = 0;
+    double planSeconds = 0;
+    vector<Allocation> allocations = allocateUAVs(uavs, outposts);
+    while (true)
+    {
+        double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (duration > 0 && elapsed >= duration)
+            break;
+        bool sourcesDone = replaysRunning.load() == 0 && udpPort == 0;
+
+        size_t taken = coalescer.drain(ring, batchLimit);
+        if (taken == 0)
+        {
+            if (sourcesDone)
+                break;
+            this_thread::sleep_for(chrono::milliseconds(intervalMs));
+            continue;
+        }
+        drained += taken;
+        largestBatch = max(largestBatch, taken);
+        size_t changes = coalescer.apply(uavs, outposts);
+        applied += changes;
+
+        auto planStart = chrono::steady_clock::now();
+        allocations = allocateUAVs(uavs, outposts);
+        planSeconds += chrono::duration<double>(chrono::steady_clock::now() - planStart).count();
+        replans++;
+
+        if (!quiet)
+        {
+            double energy = 0;
+            for (const auto &a : allocations)
+                energy += a.energyCost;
+            cout << "Batch " << replans << ": " << taken << " messages -> " << changes << " updates | Allocated: "
+                 << allocations.size() << " | Energy: " << energy << "\n";
+        }
+    }
+    stop = true;
+    for (auto &p : producers)
+        p.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "\nFinal UAV Allocation:\n";
+    for (const auto &allocation : allocations)
+    {
+        cout << "UAV " << allocation.uavId << " assigned to Outpost " << allocation.outpostId
+             << " with Energy Cost: " << allocation.energyCost << "\n";
+    }
+    cout << "\nMessages: " << stats.produced << " produced, " << drained << " drained, " << stats.dropped
+         << " dropped (ring full), " << stats.malformed << " malformed, " << coalescer.unknownIds() << " unknown ids\n";
+    cout << "Coalesced updates applied: " << applied << " | Replans: " << replans << " | Largest batch: " << largestBatch
+         << "\n";
+    cout << "Ingest rate: " << (seconds > 0 ? drained / seconds : 0) << " msgs/s | Planning time: " << planSeconds
+         << " s of " << seconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,440 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <string>
+#include <ctime>
+
+using namespace std;
+
+// Constants for priority calculation weights (same as v6)
+const double ALPHA = 0.5; // Weight for resource urgency
+const double BETA = 0.3;  // Weight for distance (inverted)
+const double GAMMA = 0.2; // Weight for criticality level
+
+// Payload-aware energy: a full load costs this much more per km than empty
+const double PAYLOAD_FACTOR = 0.5;
+// Soft penalty per unit of energy over the battery
+const double OVERDRAW_PENALTY = 100.0;
+const double DUPLICATE_PENALTY = 1000.0; // v5
+
+// Structure for UAVs
+struct UAV
+{
+    int id;
+    double weight_capacity;
+    double energy_per_km;
+    double total_energy;
+};
+
+// Structure for Outposts
+struct Outpost
+{
+    int id;
+    double medicine;
+    double food;
+    double weapons;
+    double x, y;
+    int priority; // Criticality level 1-5 as entered
+};
+
+// Structure for Base Station
+struct BaseStation
+{
+    double x, y;
+};
+
+// Function to calculate Euclidean distance
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Function to calculate priority for an outpost (v6)
+double calculatePriority(const Outpost &outpost, const BaseStation &base)
+{
+    double resource_urgency = outpost.medicine + outpost.food + outpost.weapons;
+    double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+
+    // Avoid division by zero
+    double distance_factor = (distance > 0) ? (1.0 / distance) : 1.0;
+
+    return ALPHA * resource_urgency + BETA * distance_factor + GAMMA * outpost.priority;
+}
+
+// Everything the kernels read, flattened into arrays once per run
+struct Instance
+{
+    // Per UAV
+    vector<double> energyPerKm, totalEnergy, capacity;
+    // Per outpost
+    vector<double> distance;         // From the base
+    vector<double> level;            // Criticality as entered (v1, v5)
+    vector<double> weightedPriority; // v6 calculatePriority
+    vector<double> demand;           // medicine + food + weapons
+};
+
+// ---------------------------------------------------------------------------
+// Fitness policies. Each dimension is a set of small structs with static
+// inline members; a kernel is instantiated for every combination, so the
+// choices are resolved at compile time and the inner loop has no virtual
+// calls and no switches on configuration.
+// ---------------------------------------------------------------------------
+
+// Energy model: energy per km for UAV u carrying outpost o's demand
+struct LinearEnergy
+{
+    static constexpr const char *name = "linear";
+    static double perKm(const Instance &in, int u, int) { return in.energyPerKm[u]; }
+};
+struct PayloadEnergy
+{
+    static constexpr const char *name = "payload";
+    static double perKm(const Instance &in, int u, int o)
+    {
+        double load = min(1.0, in.demand[o] / max(1e-9, in.capacity[u]));
+        return in.energyPerKm[u] * (1.0 + PAYLOAD_FACTOR * load);
+    }
+};
+
+// Trip: legs flown per sortie
+struct OneWay
+{
+    static constexpr const char *name = "one-way";
+    static constexpr double legs = 1.0;
+};
+struct RoundTrip
+{
+    static constexpr const char *name = "round-trip";
+    static constexpr double legs = 2.0;
+};
+
+// Priority term: folds an assignment's energy and the outpost's priority
+// into its cost contribution
+struct SubtractPriority // v1: energy - 10 * priority
+{
+    static constexpr const char *name = "subtract";
+    static double cost(const Instance &in, int o, double energy) { return energy - 10.0 * in.level[o]; }
+};
+struct ReciprocalPriority // v5: energy + 100 / (priority + 1)
+{
+    static constexpr const char *name = "reciprocal";
+    static double cost(const Instance &in, int o, double energy) { return energy + 100.0 / (in.level[o] + 1.0); }
+};
+struct DividePriority // v6: energy / calculatePriority
+{
+    static constexpr const char *name = "divide";
+    static double cost(const Instance &in, int o, double energy) { return energy / in.weightedPriority[o]; }
+};
+
+// Penalty scheme
+struct RejectInfeasible // v1, v6: any UAV out of range invalidates the plan
+{
+    static constexpr const char *name = "reject";
+    static constexpr bool rejects = true, duplicates = false, soft = false;
+};
+struct DuplicatePenalty // v5: reject out of range, +1000 per repeated outpost
+{
+    static constexpr const char *name = "duplicate";
+    static constexpr bool rejects = true, duplicates = true, soft = false;
+};
+struct SoftPenalty // Keep infeasible plans, charged by energy overdraw and duplicates
+{
+    static constexpr const char *name = "soft";
+    static constexpr bool rejects = false, duplicates = true, soft = true;
+};
+
+// Per-thread scratch for duplicate detection
+struct Scratch
+{
+    vector<int> seen;
+    int stamp = 0;
+};
+
+template <typename Energy, typename Trip, typename Priority, typename Penalty>
+struct FitnessKernel
+{
+    static double evaluate(const Instance &in, const vector<int> &assignment, Scratch &scratch)
+    {
+        double total = 0.0, overdraw = 0.0;
+        int duplicates = 0;
+        bool infeasible = false;
+        if constexpr (Penalty::duplicates)
+            scratch.stamp++;
+
+        for (size_t u = 0; u < assignment.size(); u++)
+        {
+            int o = assignment[u];
+            double energy = Trip::legs * in.distance[o] * Energy::perKm(in, u, o);
+            total += Priority::cost(in, o, energy);
+            if constexpr (Penalty::rejects)
+                infeasible |= energy > in.totalEnergy[u];
+            if constexpr (Penalty::soft)
+                overdraw += max(0.0, energy - in.totalEnergy[u]);
+            if constexpr (Penalty::duplicates)
+            {
+                duplicates += scratch.seen[o] == scratch.stamp;
+                scratch.seen[o] = scratch.stamp;
+            }
+        }
+
+        if constexpr (Penalty::duplicates)
+            total += DUPLICATE_PENALTY * duplicates;
+        if constexpr (Penalty::soft)
+            total += OVERDRAW_PENALTY * overdraw;
+        if constexpr (Penalty::rejects)
+            return infeasible ? numeric_limits<double>::max() : total;
+        return total;
+    }
+};
+
+struct PsoConfig
+{
+    int particles = 50, iterations = 100;
+    unsigned seed = 0;
+};
+
+struct PsoResult
+{
+    vector<int> assignment;
+    double fitness;
+    long long evaluations;
+};
+
+// v6 PSO, templated on the fitness kernel so evaluate() inlines into the loop
+template <typename Kernel>
+PsoResult pso(const Instance &in, const PsoConfig &config)
+{
+    size_t m = in.energyPerKm.size(), n = in.distance.size();
+    mt19937 rng(config.seed);
+    uniform_int_distribution<int> anyOutpost(0, n - 1);
+    Scratch scratch{vector<int>(n, 0), 0};
+
+    vector<vector<int>> position(config.particles, vector<int>(m)), best(config.particles);
+    vector<double> bestFitness(config.particles, numeric_limits<double>::max());
+    for (auto &p : position)
+        for (auto &gene : p)
+            gene = anyOutpost(rng); // Random UAV to Outpost mapping
+
+    PsoResult result{position[0], numeric_limits<double>::max(), 0};
+    for (int iter = 0; iter < config.iterations; iter++)
+    {
+        for (int p = 0; p < config.particles; p++)
+        {
+            double fitness = Kernel::evaluate(in, position[p], scratch);
+            result.evaluations++;
+            if (fitness < bestFitness[p])
+            {
+                bestFitness[p] = fitness;
+                best[p] = position[p];
+            }
+            if (fitness < result.fitness)
+            {
+                result.fitness = fitness;
+                result.assignment = position[p];
+            }
+        }
+
+        // Update particles (v6 rule)
+        for (int p = 0; p < config.particles; p++)
+        {
+            if (best[p].empty())
+                continue;
+            for (size_t i = 0; i < m; i++)
+                position[p][i] = (rng() & 1) ? best[p][i] : result.assignment[i];
+        }
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Runtime registry: one entry per (energy, trip, priority, penalty)
+// combination, generated from the type lists below.
+// ---------------------------------------------------------------------------
+
+struct RegistryEntry
+{
+    string energy, trip, priority, penalty;
+    PsoResult (*solve)(const Instance &, const PsoConfig &);
+    double (*evaluate)(const Instance &, const vector<int> &, Scratch &);
+};
+
+template <typename... Ts>
+struct TypeList
+{
+};
+
+template <typename E, typename T, typename P, typename Q>
+void registerOne(vector<RegistryEntry> &registry)
+{
+    using Kernel = FitnessKernel<E, T, P, Q>;
+    registry.push_back({E::name, T::name, P::name, Q::name, &pso<Kernel>, &Kernel::evaluate});
+}
+
+template <typename E, typename T, typename P, typename... Qs>
+void registerPenalties(vector<RegistryEntry> &registry, TypeList<Qs...>)
+{
+    (registerOne<E, T, P, Qs>(registry), ...);
+}
+
+template <typename E, typename T, typename Qs, typename... Ps>
+void registerPriorities(vector<RegistryEntry> &registry, TypeList<Ps...>, Qs penalties)
+{
+    (registerPenalties<E, T, Ps>(registry, penalties), ...);
+}
+
+template <typename E, typename Ps, typename Qs, typename... Ts>
+void registerTrips(vector<RegistryEntry> &registry, TypeList<Ts...>, Ps priorities, Qs penalties)
+{
+    (registerPriorities<E, Ts>(registry, priorities, penalties), ...);
+}
+
+template <typename... Es, typename Ts, typename Ps, typename Qs>
+vector<RegistryEntry> buildRegistry(TypeList<Es...>, Ts trips, Ps priorities, Qs penalties)
+{
+    vector<RegistryEntry> registry;
+    (registerTrips<Es>(registry, trips, priorities, penalties), ...);
+    return registry;
+}
+
+const vector<RegistryEntry> &fitnessRegistry()
+{
+    static const vector<RegistryEntry> registry = buildRegistry(
+        TypeList<LinearEnergy, PayloadEnergy>{}, TypeList<OneWay, RoundTrip>{},
+        TypeList<SubtractPriority, ReciprocalPriority, DividePriority>{},
+        TypeList<RejectInfeasible, DuplicatePenalty, SoftPenalty>{});
+    return registry;
+}
+
+const RegistryEntry *findFitness(const string &energy, const string &trip, const string &priority,
+                                 const string &penalty)
+{
+    for (const auto &entry : fitnessRegistry())
+        if (entry.energy == energy && entry.trip == trip && entry.priority == priority && entry.penalty == penalty)
+            return &entry;
+    return nullptr;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --preset=v1|v5|v6  --energy=  --trip=  --priority=  --penalty=  --list
+    //          --particles=N  --iterations=I  --seed=S
+    // A preset fills in all four choices; later flags override single ones.
+    string energy = "linear", trip = "one-way", priority = "divide", penalty = "reject"; // v6
+    PsoConfig config;
+    config.seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--preset=v1")
+            energy = "linear", trip = "round-trip", priority = "subtract", penalty = "reject";
+        else if (arg == "--preset=v5")
+            energy = "linear", trip = "round-trip", priority = "reciprocal", penalty = "duplicate";
+        else if (arg == "--preset=v6")
+            energy = "linear", trip = "one-way", priority = "divide", penalty = "reject";
+        else if (arg.rfind("--energy=", 0) == 0)
+            energy = arg.substr(9);
+        else if (arg.rfind("--trip=", 0) == 0)
+            trip = arg.substr(7);
+        else if (arg.rfind("--priority=", 0) == 0)
+            priority = arg.substr(11);
+        else if (arg.rfind("--penalty=", 0) == 0)
+            penalty = arg.substr(10);
+        else if (arg.rfind("--particles=", 0) == 0)
+            config.particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            config.iterations = max(1, stoi(arg.substr(13)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            config.seed = stoul(arg.substr(7));
+        else if (arg == "--list")
+        {
+            for (const auto &entry : fitnessRegistry())
+                cout << entry.energy << " " << entry.trip << " " << entry.priority << " " << entry.penalty << "\n";
+            return 0;
+        }
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    const RegistryEntry *fitness = findFitness(energy, trip, priority, penalty);
+    if (!fitness)
+    {
+        cerr << "No fitness policy " << energy << "/" << trip << "/" << priority << "/" << penalty
+             << " (see --list)\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int n, m;
+    cout << "Enter number of outposts: ";
+    cin >> n;
+    cout << "Enter number of UAVs: ";
+    cin >> m;
+
+    vector<UAV> uavs(m);
+    vector<Outpost> outposts(n);
+    BaseStation base;
+
+    // Input UAV details
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < m; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weight_capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    // Input Outpost details
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < n; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    // Input Base Station coordinates
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> base.x >> base.y;
+    if (n == 0 || m == 0)
+    {
+        cout << "\nNothing to allocate.\n";
+        return 0;
+    }
+
+    // Flatten once; the v6 priority is computed now that the base is known
+    Instance in;
+    for (const auto &uav : uavs)
+    {
+        in.energyPerKm.push_back(uav.energy_per_km);
+        in.totalEnergy.push_back(uav.total_energy);
+        in.capacity.push_back(uav.weight_capacity);
+    }
+    for (const auto &outpost : outposts)
+    {
+        in.distance.push_back(calculateDistance(base.x, base.y, outpost.x, outpost.y));
+        in.level.push_back(outpost.priority);
+        in.weightedPriority.push_back(max(1e-9, calculatePriority(outpost, base)));
+        in.demand.push_back(outpost.medicine + outpost.food + outpost.weapons);
+    }
+
+    auto start = chrono::steady_clock::now();
+    PsoResult result = fitness->solve(in, config);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Output best UAV allocation
+    cout << "\nBest UAV Allocation:\n";
+    for (size_t i = 0; i < result.assignment.size(); i++)
+    {
+        cout << "UAV " << uavs[i].id << " assigned to Outpost " << outposts[result.assignment[i]].id << "\n";
+    }
+
+    cout << "Fitness (" << energy << "/" << trip << "/" << priority << "/" << penalty << "): " << result.fitness << "\n";
+    cout << "Evaluations: " << result.evaluations << " in " << seconds << " s ("
+         << (seconds > 0 ? result.evaluations / seconds : 0) << " per second)\n";
+
+    return 0;
+}
@@ -0,0 +1,660 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <unordered_map>
+
+using namespace std;
+
+const int MINHASH_SIZE = 64;           // Hash functions per outpost fingerprint
+const double UNSERVED_PENALTY = 1000.0; // Per priority level left unserved
+const double MUTATION_RATE = 0.02;
+const double SAME_INSTANCE = 0.999; // Similarity at which a stored plan is replaced, not added
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+struct Instance
+{
+    vector<UAV> uavs;
+    vector<Outpost> outposts;
+    double baseX, baseY;
+    vector<double> distance;  // Base to each outpost
+    vector<vector<int>> reach; // Outposts each UAV can reach
+};
+
+double energyCost(const Instance &in, int u, int o)
+{
+    return in.distance[o] * in.uavs[u].energyPerKm;
+}
+
+// An assignment maps each UAV to an outpost index, or -1 when idle
+double evaluate(const Instance &in, const vector<int> &assignment)
+{
+    double total = 0.0;
+    vector<bool> served(in.outposts.size(), false);
+    for (size_t u = 0; u < assignment.size(); u++)
+        if (assignment[u] >= 0)
+        {
+            total += energyCost(in, u, assignment[u]);
+            served[assignment[u]] = true;
+        }
+    for (size_t o = 0; o < in.outposts.size(); o++)
+        if (!served[o])
+            total += UNSERVED_PENALTY * in.outposts[o].priority;
+    return total;
+}
+
+// Drop out-of-range UAVs and second visits to the same outpost
+void repair(const Instance &in, vector<int> &assignment)
+{
+    vector<bool> taken(in.outposts.size(), false);
+    for (size_t u = 0; u < assignment.size(); u++)
+    {
+        int o = assignment[u];
+        if (o < 0)
+            continue;
+        if (taken[o] || energyCost(in, u, o) > in.uavs[u].totalEnergy)
+            assignment[u] = -1;
+        else
+            taken[o] = true;
+    }
+}
+
+// v7 allocation over whatever the assignment leaves open: highest priority
+// outposts first, each to the first idle UAV that can reach it
+void greedyFill(const Instance &in, vector<int> &assignment)
+{
+    vector<int> order(in.outposts.size());
+    for (size_t o = 0; o < order.size(); o++)
+        order[o] = o;
+    stable_sort(order.begin(), order.end(),
+                [&](int a, int b) { return in.outposts[a].priority > in.outposts[b].priority; });
+
+    vector<bool> taken(in.outposts.size(), false);
+    for (int o : assignment)
+        if (o >= 0)
+            taken[o] = true;
+    for (int o : order)
+    {
+        if (taken[o])
+            continue;
+        for (size_t u = 0; u < assignment.size(); u++)
+            if (assignment[u] < 0 && energyCost(in, u, o) <= in.uavs[u].totalEnergy)
+            {
+                assignment[u] = o;
+                taken[o] = true;
+                break;
+            }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Instance fingerprints. Outposts are reduced to the set of (grid cell,
+// priority) pairs they occupy and summarised by a MinHash signature, whose agreement rate estimates
+// the Jaccard similarity of two cell sets. The fleet is a histogram over UAV
+// types, compared by weighted Jaccard. Base proximity makes up the rest.
+// ---------------------------------------------------------------------------
+
+uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct FleetType
+{
+    double capacity, energyPerKm, totalEnergy;
+    int count;
+
+    bool sameType(const FleetType &o) const
+    {
+        return capacity == o.capacity && energyPerKm == o.energyPerKm && totalEnergy == o.totalEnergy;
+    }
+    bool operator<(const FleetType &o) const
+    {
+        if (capacity != o.capacity)
+            return capacity < o.capacity;
+        if (energyPerKm != o.energyPerKm)
+            return energyPerKm < o.energyPerKm;
+        return totalEnergy < o.totalEnergy;
+    }
+};
+
+struct Fingerprint
+{
+    vector<uint64_t> minhash;
+    vector<FleetType> fleet; // Sorted by type
+    double baseX, baseY;
+};
+
+uint64_t cellKey(double x, double y, double cell)
+{
+    int64_t cx = (int64_t)floor(x / cell), cy = (int64_t)floor(y / cell);
+    return ((uint64_t)cx << 32) ^ (uint64_t)(uint32_t)cy;
+}
+
+Fingerprint fingerprint(const Instance &in, double cell)
+{
+    Fingerprint fp;
+    fp.minhash.assign(MINHASH_SIZE, numeric_limits<uint64_t>::max());
+    for (const auto &outpost : in.outposts)
+    {
+        uint64_t key = cellKey(outpost.x, outpost.y, cell) ^ splitmix64(~(uint64_t)outpost.priority);
+        for (int h = 0; h < MINHASH_SIZE; h++)
+            fp.minhash[h] = min(fp.minhash[h], splitmix64(key ^ splitmix64(h + 1)));
+    }
+
+    for (const auto &uav : in.uavs)
+        fp.fleet.push_back({uav.capacity, uav.energyPerKm, uav.totalEnergy, 1});
+    sort(fp.fleet.begin(), fp.fleet.end());
+    vector<FleetType> merged;
+    for (const auto &type : fp.fleet)
+    {
+        if (!merged.empty() && merged.back().sameType(type))
+            merged.back().count++;
+        else
+            merged.push_back(type);
+    }
+    fp.fleet = merged;
+    fp.baseX = in.baseX;
+    fp.baseY = in.baseY;
+    return fp;
+}
+
+double similarity(const Fingerprint &a, const Fingerprint &b, double cell)
+{
+    int agree = 0;
+    for (int h = 0; h < MINHASH_SIZE; h++)
+        agree += a.minhash[h] == b.minhash[h];
+    double outposts = (double)agree / MINHASH_SIZE;
+
+    // Weighted Jaccard over the two sorted histograms
+    double shared = 0, either = 0;
+    size_t i = 0, j = 0;
+    while (i < a.fleet.size() || j < b.fleet.size())
+    {
+        if (j == b.fleet.size() || (i < a.fleet.size() && a.fleet[i] < b.fleet[j]))
+            either += a.fleet[i++].count;
+        else if (i == a.fleet.size() || b.fleet[j] < a.fleet[i])
+            either += b.fleet[j++].count;
+        else
+        {
+            shared += min(a.fleet[i].count, b.fleet[j].count);
+            either += max(a.fleet[i].count, b.fleet[j].count);
+            i++, j++;
+        }
+    }
+    double fleet = either > 0 ? shared / either : 1.0;
+
+    double base = 1.0 / (1.0 + calculateDistance(a.baseX, a.baseY, b.baseX, b.baseY) / cell);
+    return 0.6 * outposts + 0.3 * fleet + 0.1 * base;
+}
+
+// ---------------------------------------------------------------------------
+// Solution store. A plan is kept as (UAV id and type, outpost position) pairs
+// rather than indices, so it can be mapped onto an instance whose outposts
+// moved a little, were added or removed, or arrive in a different order.
+// One plan per line in a text file; rewritten through a temporary file.
+// ---------------------------------------------------------------------------
+
+struct StoredPair
+{
+    int uavId;
+    double capacity, energyPerKm, totalEnergy;
+    double x, y;
+};
+
+struct StoredPlan
+{
+    Fingerprint fp;
+    double fitness;
+    vector<StoredPair> pairs;
+};
+
+class SolutionStore
+{
+public:
+    // A missing file is an empty store; malformed lines are skipped
+    void load(const string &path)
+    {
+        ifstream file(path);
+        string line;
+        while (getline(file, line))
+        {
+            istringstream in(line);
+            string tag;
+            StoredPlan plan;
+            size_t hashes, types, pairs;
+            if (!(in >> tag) || tag != "plan" || !(in >> plan.fitness >> plan.fp.baseX >> plan.fp.baseY >> hashes) ||
+                hashes != (size_t)MINHASH_SIZE)
+                continue;
+            plan.fp.minhash.resize(hashes);
+            for (auto &h : plan.fp.minhash)
+                in >> h;
+            in >> types;
+            plan.fp.fleet.resize(in ? types : 0);
+            for (auto &t : plan.fp.fleet)
+                in >> t.capacity >> t.energyPerKm >> t.totalEnergy >> t.count;
+            in >> pairs;
+            plan.pairs.resize(in ? pairs : 0);
+            for (auto &p : plan.pairs)
+                in >> p.uavId >> p.capacity >> p.energyPerKm >> p.totalEnergy >> p.x >> p.y;
+            if (in)
+                plans.push_back(plan);
+            else
+                skipped++;
+        }
+    }
+
+    bool save(const string &path) const
+    {
+        string tmp = path + ".tmp";
+        {
+            ofstream file(tmp);
+            if (!file)
+                return false;
+            file << setprecision(17);
+            for (const auto &plan : plans)
+            {
+                file << "plan " << plan.fitness << " " << plan.fp.baseX << " " << plan.fp.baseY << " "
+                     << plan.fp.minhash.size();
+                for (auto h : plan.fp.minhash)
+                    file << " " << h;
+                file << " " << plan.fp.fleet.size();
+                for (const auto &t : plan.fp.fleet)
+                    file << " " << t.capacity << " " << t.energyPerKm << " " << t.totalEnergy << " " << t.count;
+                file << " " << plan.pairs.size();
+                for (const auto &p : plan.pairs)
+                    file << " " << p.uavId << " " << p.capacity << " " << p.energyPerKm << " " << p.totalEnergy
+                         << " " << p.x << " " << p.y;
+                file << "\n";
+            }
+            if (!file)
+                return false;
+        }
+        return rename(tmp.c_str(), path.c_str()) == 0;
+    }
+
+    // Up to k plans with similarity >= minSimilarity, most similar first
+    vector<pair<double, const StoredPlan *>> query(const Fingerprint &fp, double cell, size_t k,
+                                                   double minSimilarity) const
+    {
+        vector<pair<double, const StoredPlan *>> found;
+        for (const auto &plan : plans)
+        {
+            double s = similarity(fp, plan.fp, cell);
+            if (s >= minSimilarity)
+                found.push_back({s, &plan});
+        }
+        sort(found.begin(), found.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+        if (found.size() > k)
+            found.resize(k);
+        return found;
+    }
+
+    // A plan for (nearly) the same instance replaces the stored one: the two
+    // fitnesses were measured on different instances, and the new plan was
+    // searched with the stored one as a seed. Either way the plan becomes the
+    // newest; the oldest are dropped past the limit.
+    void insert(const StoredPlan &plan, double cell, size_t limit)
+    {
+        for (size_t i = 0; i < plans.size(); i++)
+            if (similarity(plan.fp, plans[i].fp, cell) >= SAME_INSTANCE)
+            {
+                plans.erase(plans.begin() + i);
+                break;
+            }
+        plans.push_back(plan);
+        if (plans.size() > limit)
+            plans.erase(plans.begin(), plans.begin() + (plans.size() - limit));
+    }
+
+    size_t size() const { return plans.size(); }
+    size_t skippedLines() const { return skipped; }
+
+private:
+    vector<StoredPlan> plans; // Oldest first
+    size_t skipped = 0;
+};
+
+// Map a stored plan onto the current instance. UAVs match by id when the type
+// agrees, otherwise by any idle UAV of the same type. Outposts match the
+// nearest unused outpost within one cell of the stored position. Pairs that do
+// not map, or are out of range here, are dropped.
+vector<int> remap(const StoredPlan &plan, const Instance &in, double cell)
+{
+    unordered_map<uint64_t, vector<int>> grid;
+    for (size_t o = 0; o < in.outposts.size(); o++)
+        grid[cellKey(in.outposts[o].x, in.outposts[o].y, cell)].push_back(o);
+    unordered_map<int, int> byId;
+    for (size_t u = 0; u < in.uavs.size(); u++)
+        byId[in.uavs[u].id] = u;
+
+    vector<int> assignment(in.uavs.size(), -1);
+    vector<bool> outpostTaken(in.outposts.size(), false);
+    auto typeMatches = [](const UAV &uav, const StoredPair &p) {
+        return uav.capacity == p.capacity && uav.energyPerKm == p.energyPerKm && uav.totalEnergy == p.totalEnergy;
+    };
+
+    for (const auto &p : plan.pairs)
+    {
+        int u = -1;
+        auto it = byId.find(p.uavId);
+        if (it != byId.end() && assignment[it->second] < 0 && typeMatches(in.uavs[it->second], p))
+            u = it->second;
+        for (size_t v = 0; u < 0 && v < in.uavs.size(); v++)
+            if (assignment[v] < 0 && typeMatches(in.uavs[v], p))
+                u = v;
+        if (u < 0)
+            continue;
+
+        int best = -1;
+        double bestDistance = cell;
+        int64_t cx = (int64_t)floor(p.x / cell), cy = (int64_t)floor(p.y / cell);
+        for (int64_t dx = -1; dx <= 1; dx++)
+            for (int64_t dy = -1; dy <= 1; dy++)
+            {
+                auto cellIt = grid.find(((uint64_t)(cx + dx) << 32) ^ (uint64_t)(uint32_t)(cy + dy));
+                if (cellIt == grid.end())
+                    continue;
+                for (int o : cellIt->second)
+                {
+                    double d = calculateDistance(p.x, p.y, in.outposts[o].x, in.outposts[o].y);
+                    if (!outpostTaken[o] && d <= bestDistance)
+                        best = o, bestDistance = d;
+                }
+            }
+        if (best >= 0 && energyCost(in, u, best) <= in.uavs[u].totalEnergy)
+        {
+            assignment[u] = best;
+            outpostTaken[best] = true;
+        }
+    }
+    return assignment;
+}
+
+StoredPlan toStoredPlan(const Instance &in, const Fingerprint &fp, const vector<int> &assignment, double fitness)
+{
+    StoredPlan plan{fp, fitness, {}};
+    for (size_t u = 0; u < assignment.size(); u++)
+        if (assignment[u] >= 0)
+        {
+            const UAV &uav = in.uavs[u];
+            const Outpost &outpost = in.outposts[assignment[u]];
+            plan.pairs.push_back({uav.id, uav.capacity, uav.energyPerKm, uav.totalEnergy, outpost.x, outpost.y});
+        }
+    return plan;
+}
+
+// ---------------------------------------------------------------------------
+// PSO over per-UAV genes (v6 update rule), seeded with the warm starts
+// ---------------------------------------------------------------------------
+
+struct Particle
+{
+    vector<int> position, best;
+    double fitness, bestFitness;
+};
+
+struct PsoResult
+{
+    vector<int> assignment;
+    double fitness;
+    int iterations;        // Run before the patience limit stopped the search
+    int lastImprovement;   // Iteration of the final global-best improvement
+};
+
+int randomGene(const Instance &in, int u, mt19937 &rng)
+{
+    const auto &reach = in.reach[u];
+    uniform_int_distribution<int> pick(0, reach.size()); // reach.size() means idle
+    int k = pick(rng);
+    return k < (int)reach.size() ? reach[k] : -1;
+}
+
+PsoResult pso(const Instance &in, const vector<vector<int>> &seeds, int numParticles, int maxIterations,
+              int patience, mt19937 &rng)
+{
+    size_t m = in.uavs.size();
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<Particle> swarm(max<size_t>(numParticles, seeds.size()));
+    PsoResult result{vector<int>(m, -1), numeric_limits<double>::max(), 0, 0};
+
+    for (size_t p = 0; p < swarm.size(); p++)
+    {
+        auto &particle = swarm[p];
+        if (p < seeds.size())
+            particle.position = seeds[p];
+        else
+        {
+            particle.position.resize(m);
+            for (size_t u = 0; u < m; u++)
+                particle.position[u] = randomGene(in, u, rng);
+        }
+        repair(in, particle.position);
+        particle.fitness = particle.bestFitness = evaluate(in, particle.position);
+        particle.best = particle.position;
+        if (particle.fitness < result.fitness)
+        {
+            result.fitness = particle.fitness;
+            result.assignment = particle.position;
+        }
+    }
+
+    for (int iter = 1; iter <= maxIterations && iter - result.lastImprovement <= patience; iter++)
+    {
+        result.iterations = iter;
+        for (auto &particle : swarm)
+        {
+            for (size_t u = 0; u < m; u++)
+            {
+                if (unit(rng) < MUTATION_RATE)
+                    particle.position[u] = randomGene(in, u, rng);
+                else
+                    particle.position[u] = (rng() & 1) ? particle.best[u] : result.assignment[u];
+            }
+            repair(in, particle.position);
+            particle.fitness = evaluate(in, particle.position);
+            if (particle.fitness < particle.bestFitness)
+            {
+                particle.bestFitness = particle.fitness;
+                particle.best = particle.position;
+            }
+        }
+        for (const auto &particle : swarm)
+            if (particle.fitness < result.fitness)
+            {
+                result.fitness = particle.fitness;
+                result.assignment = particle.position;
+                result.lastImprovement = iter;
+            }
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --store=FILE  --warm=K  --min-similarity=S  --cell=C  --store-limit=N
+    //          --no-warm  --no-save  --solver=pso|greedy
+    //          --particles=N  --iterations=I  --patience=P  --seed=S
+    string storePath = "uav_plans.db", solver = "pso";
+    size_t warmCount = 3, storeLimit = 500;
+    double minSimilarity = 0.3, cell = 10.0;
+    bool warm = true, saveBest = true;
+    int numParticles = 30, maxIterations = 500, patience = 50;
+    unsigned seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--store=", 0) == 0)
+            storePath = arg.substr(8);
+        else if (arg.rfind("--warm=", 0) == 0)
+            warmCount = stoul(arg.substr(7));
+        else if (arg.rfind("--min-similarity=", 0) == 0)
+            minSimilarity = stod(arg.substr(17));
+        else if (arg.rfind("--cell=", 0) == 0)
+            cell = stod(arg.substr(7));
+        else if (arg.rfind("--store-limit=", 0) == 0)
+            storeLimit = max(1UL, stoul(arg.substr(14)));
+        else if (arg == "--no-warm")
+            warm = false;
+        else if (arg == "--no-save")
+            saveBest = false;
+        else if (arg == "--solver=pso" || arg == "--solver=greedy")
+            solver = arg.substr(9);
+        else if (arg.rfind("--particles=", 0) == 0)
+            numParticles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            maxIterations = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--patience=", 0) == 0)
+            patience = max(1, stoi(arg.substr(11)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (!(cell > 0))
+    {
+        cerr << "--cell must be positive\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    Instance in;
+    in.uavs.resize(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> in.uavs[i].id >> in.uavs[i].capacity >> in.uavs[i].energyPerKm >> in.uavs[i].totalEnergy;
+    }
+
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> in.baseX >> in.baseY;
+
+    in.outposts.resize(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> in.outposts[i].id >> in.outposts[i].medicine >> in.outposts[i].food >> in.outposts[i].weapons >> in.outposts[i].x >> in.outposts[i].y >> in.outposts[i].priority;
+    }
+
+    for (const auto &outpost : in.outposts)
+        in.distance.push_back(calculateDistance(in.baseX, in.baseY, outpost.x, outpost.y));
+    in.reach.resize(numUAVs);
+    for (int u = 0; u < numUAVs; u++)
+        for (int o = 0; o < numOutposts; o++)
+            if (energyCost(in, u, o) <= in.uavs[u].totalEnergy)
+                in.reach[u].push_back(o);
+
+    // Retrieve and remap similar past plans; each is completed greedily
+    Fingerprint fp = fingerprint(in, cell);
+    SolutionStore store;
+    store.load(storePath);
+    vector<vector<int>> seeds;
+    if (warm)
+    {
+        auto similar = store.query(fp, cell, warmCount, minSimilarity);
+        for (const auto &[score, plan] : similar)
+        {
+            vector<int> seedPlan = remap(*plan, in, cell);
+            int mapped = count_if(seedPlan.begin(), seedPlan.end(), [](int o) { return o >= 0; });
+            greedyFill(in, seedPlan);
+            cout << "\nWarm start: similarity " << score << ", " << mapped << "/" << plan->pairs.size()
+                 << " assignments remapped";
+            seeds.push_back(seedPlan);
+        }
+        if (similar.empty())
+            cout << "\nWarm start: no similar plan among " << store.size() << " stored";
+        cout << "\n";
+    }
+
+    // A cold v7 run is always a candidate, so a poor warm start cannot hurt
+    vector<int> cold(numUAVs, -1);
+    greedyFill(in, cold);
+    seeds.push_back(cold);
+
+    mt19937 rng(seed);
+    vector<int> assignment;
+    double fitness;
+    if (solver == "greedy")
+    {
+        assignment = *min_element(seeds.begin(), seeds.end(), [&](const auto &a, const auto &b) {
+            return evaluate(in, a) < evaluate(in, b);
+        });
+        fitness = evaluate(in, assignment);
+    }
+    else
+    {
+        PsoResult result = pso(in, seeds, numParticles, maxIterations, patience, rng);
+        assignment = result.assignment;
+        fitness = result.fitness;
+        cout << "PSO: " << result.iterations << " iterations, last improvement at iteration "
+             << result.lastImprovement << "\n";
+    }
+
+    cout << "\nBest UAV Allocation:\n";
+    int served = 0;
+    double totalEnergy = 0.0;
+    for (int u = 0; u < numUAVs; u++)
+    {
+        if (assignment[u] < 0)
+            continue;
+        double energy = energyCost(in, u, assignment[u]);
+        cout << "UAV " << in.uavs[u].id << " assigned to Outpost " << in.outposts[assignment[u]].id
+             << " with Energy Cost: " << energy << "\n";
+        served++;
+        totalEnergy += energy;
+    }
+    cout << "Served " << served << "/" << numOutposts << " outposts, total energy " << totalEnergy
+         << ", fitness " << fitness << "\n";
+
+    if (saveBest)
+    {
+        store.insert(toStoredPlan(in, fp, assignment, fitness), cell, storeLimit);
+        if (!store.save(storePath))
+            cerr << "Could not write solution store " << storePath << "\n";
+    }
+
+    return 0;
+}
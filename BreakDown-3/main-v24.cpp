@@ -0,0 +1,410 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <ctime>
+#include <cstdint>
+
+using namespace std;
+
+// Constants for priority calculation weights (same as v6)
+const double ALPHA = 0.5; // Weight for resource urgency
+const double BETA = 0.3;  // Weight for distance (inverted)
+const double GAMMA = 0.2; // Weight for criticality level
+
+const double MUTATION_RATE = 0.02;
+// Charged per unit of infeasibility (share of UAVs out of range, or of
+// feasibility probability below target); outweighs any realistic cost
+const double SHORTFALL_PENALTY = 1e12;
+
+// Structure for UAVs
+struct UAV
+{
+    int id;
+    double weight_capacity;
+    double energy_per_km;
+    double total_energy;
+};
+
+// Structure for Outposts
+struct Outpost
+{
+    int id;
+    double medicine;
+    double food;
+    double weapons;
+    double x, y;
+    int priority;
+};
+
+// Structure for Base Station
+struct BaseStation
+{
+    double x, y;
+};
+
+// Function to calculate Euclidean distance
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Function to calculate priority for an outpost (v6)
+double calculatePriority(const Outpost &outpost, const BaseStation &base)
+{
+    double resource_urgency = outpost.medicine + outpost.food + outpost.weapons;
+    double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+
+    // Avoid division by zero
+    double distance_factor = (distance > 0) ? (1.0 / distance) : 1.0;
+
+    return ALPHA * resource_urgency + BETA * distance_factor + GAMMA * outpost.priority;
+}
+
+// Point-estimate data shared by both objectives
+struct Problem
+{
+    vector<double> distance, weight, demand; // Per outpost; weight = 1 / v6 priority
+    vector<double> energy_per_km, total_energy, capacity; // Per UAV
+};
+
+// v6 fitness on the point estimates. An out-of-range UAV is charged a
+// penalty instead of making the whole plan max(), so a swarm that starts
+// infeasible can still tell better plans from worse ones.
+double fitnessFunction(const vector<int> &assignment, const Problem &pr)
+{
+    double total_energy_cost = 0.0;
+    int infeasible = 0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int o = assignment[i];
+        double energy_required = pr.distance[o] * pr.energy_per_km[i];
+        infeasible += energy_required > pr.total_energy[i];
+        total_energy_cost += energy_required * pr.weight[o]; // Lower cost for high-priority outposts
+    }
+    return total_energy_cost + SHORTFALL_PENALTY * infeasible / assignment.size();
+}
+
+// ---------------------------------------------------------------------------
+// Monte Carlo scenarios. Each scenario scales every UAV's energy/km and
+// battery and every outpost's demand by an independent factor in
+// [1 - spread, 1 + spread]. The scenarios are drawn once and shared by every
+// candidate (common random numbers), so two allocations are always compared
+// on the same weather and the same demand, and their difference has far less
+// noise than independent sampling would give.
+//
+// Storage is scenario-major: all S values for one UAV or outpost are
+// contiguous. Factors are floats and outcomes 32-bit ints, so one SSE
+// register holds four scenarios of either, and the count is padded to whole
+// blocks of SCENARIO_BLOCK so the per-scenario loop vectorizes at -O2 without
+// a scalar tail.
+// ---------------------------------------------------------------------------
+
+const int SCENARIO_BLOCK = 8;
+
+struct Scenarios
+{
+    int count;                  // Requested scenarios
+    int padded;                 // count rounded up to SCENARIO_BLOCK
+    vector<float> draw_ratio;   // [uav * padded + s]: energy factor / battery factor
+    vector<float> demand;       // [outpost * padded + s]: demand factor
+    vector<double> mean_energy; // Per UAV: mean energy factor over the scenarios
+};
+
+Scenarios sampleScenarios(size_t num_uavs, size_t num_outposts, int count, double spread, mt19937_64 &rng)
+{
+    uniform_real_distribution<double> factor(1.0 - spread, 1.0 + spread);
+    int padded = (count + SCENARIO_BLOCK - 1) / SCENARIO_BLOCK * SCENARIO_BLOCK;
+    // Padding scenarios always pass, so they never change a count
+    Scenarios sc{count, padded, vector<float>(num_uavs * padded, 0.0f), vector<float>(num_outposts * padded, 0.0f),
+                 vector<double>(num_uavs, 0.0)};
+    for (size_t u = 0; u < num_uavs; u++)
+        for (int s = 0; s < count; s++)
+        {
+            double energy = factor(rng), battery = factor(rng);
+            sc.draw_ratio[u * padded + s] = energy / battery;
+            sc.mean_energy[u] += energy / count;
+        }
+    for (size_t o = 0; o < num_outposts; o++)
+        for (int s = 0; s < count; s++)
+            sc.demand[o * padded + s] = factor(rng);
+    return sc;
+}
+
+struct RobustScore
+{
+    double expected_cost;
+    double feasibility;       // Share of scenarios in which every delivery succeeds
+    double expected_failures; // Mean number of failed deliveries per scenario
+};
+
+// Per-thread buffer of failed deliveries per scenario
+struct RobustScratch
+{
+    vector<int32_t> failures;
+};
+
+// A delivery fails when its UAV runs out of battery (energy * e > battery * b)
+// or the outpost's demand exceeds the UAV's capacity; a scenario is feasible
+// when no delivery fails. Both tests are one compare against a per-UAV
+// threshold. The cost is linear in the energy
+// factors, so its mean over the scenarios is exact from the per-UAV means.
+RobustScore robustScore(const vector<int> &assignment, const Problem &pr, const Scenarios &sc, RobustScratch &scratch)
+{
+    const int S = sc.padded;
+    scratch.failures.assign(S, 0);
+    int32_t *__restrict failures = scratch.failures.data();
+    double expected_cost = 0.0;
+
+    for (size_t u = 0; u < assignment.size(); u++)
+    {
+        int o = assignment[u];
+        double energy = pr.distance[o] * pr.energy_per_km[u];
+        expected_cost += energy * pr.weight[o] * sc.mean_energy[u];
+
+        float energy_limit = energy > 0 ? pr.total_energy[u] / energy : numeric_limits<float>::infinity();
+        float demand_limit = pr.demand[o] > 0 ? pr.capacity[u] / pr.demand[o] : numeric_limits<float>::infinity();
+        const float *__restrict ratio = &sc.draw_ratio[u * S];
+        const float *__restrict demand = &sc.demand[(size_t)o * S];
+        for (int block = 0; block < S; block += SCENARIO_BLOCK)
+            for (int k = 0; k < SCENARIO_BLOCK; k++)
+                failures[block + k] += (ratio[block + k] > energy_limit) | (demand[block + k] > demand_limit);
+    }
+
+    int feasible = 0;
+    long long failed = 0;
+    for (int s = 0; s < sc.count; s++)
+    {
+        feasible += failures[s] == 0;
+        failed += failures[s];
+    }
+    return {expected_cost, (double)feasible / sc.count, (double)failed / sc.count};
+}
+
+// Lexicographic: meet the feasibility target first, then minimise expected
+// cost. Below the target, the failed-delivery rate grades plans that fail in
+// every scenario, where the probability alone would be flat.
+double robustFitness(const RobustScore &score, double target, size_t num_uavs)
+{
+    if (score.feasibility >= target)
+        return score.expected_cost;
+    return score.expected_cost +
+           SHORTFALL_PENALTY * (target - score.feasibility + score.expected_failures / num_uavs);
+}
+
+// Particle for PSO
+struct Particle
+{
+    vector<int> position; // UAV assignments
+    double fitness;
+    vector<int> best_position;
+    double best_fitness;
+};
+
+struct Objective
+{
+    const Problem &pr;
+    const Scenarios *robust; // Null for the v6 point objective
+    double target;
+};
+
+// Scores particles on `threads` threads; each thread keeps its own scratch
+void evaluateSwarm(vector<Particle> &swarm, const Objective &obj, int threads)
+{
+    auto work = [&](int t)
+    {
+        RobustScratch scratch;
+        for (size_t i = t; i < swarm.size(); i += threads)
+        {
+            Particle &p = swarm[i];
+            p.fitness = obj.robust ? robustFitness(robustScore(p.position, obj.pr, *obj.robust, scratch), obj.target,
+                                                           p.position.size())
+                                   : fitnessFunction(p.position, obj.pr);
+        }
+    };
+    if (threads == 1)
+    {
+        work(0);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.emplace_back(work, t);
+    for (auto &w : workers)
+        w.join();
+}
+
+// PSO Algorithm (v6 update rule plus a small mutation so an all-infeasible
+// swarm can still move)
+vector<int> pso(const Objective &obj, size_t num_uavs, size_t num_outposts, int num_particles, int iterations,
+                int threads, mt19937 &rng)
+{
+    vector<Particle> swarm(num_particles);
+    uniform_int_distribution<int> anyOutpost(0, num_outposts - 1);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    for (auto &p : swarm)
+    {
+        for (size_t j = 0; j < num_uavs; j++)
+            p.position.push_back(anyOutpost(rng)); // Random UAV to Outpost mapping
+        p.fitness = p.best_fitness = numeric_limits<double>::max();
+        p.best_position = p.position;
+    }
+
+    vector<int> global_best_position = swarm[0].position;
+    double global_best_fitness = numeric_limits<double>::max();
+
+    for (int iter = 0; iter < iterations; iter++)
+    {
+        evaluateSwarm(swarm, obj, threads);
+
+        for (auto &particle : swarm)
+        {
+            if (particle.fitness < particle.best_fitness)
+            {
+                particle.best_fitness = particle.fitness;
+                particle.best_position = particle.position;
+            }
+
+            if (particle.fitness < global_best_fitness)
+            {
+                global_best_fitness = particle.fitness;
+                global_best_position = particle.position;
+            }
+        }
+
+        for (auto &particle : swarm)
+        {
+            for (size_t i = 0; i < particle.position.size(); i++)
+            {
+                if (unit(rng) < MUTATION_RATE)
+                    particle.position[i] = anyOutpost(rng);
+                else
+                    particle.position[i] = (rng() & 1) ? particle.best_position[i] : global_best_position[i];
+            }
+        }
+    }
+
+    return global_best_position;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --robust  --scenarios=N  --spread=F  --target=P
+    //          --particles=N  --iterations=I  --threads=T  --seed=S
+    int particles = 50, iterations = 100, threads = 1, num_scenarios = 1024;
+    double spread = 0.2, target = 0.95;
+    bool robust = false;
+    unsigned seed = time(0);
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--robust")
+            robust = true;
+        else if (arg.rfind("--scenarios=", 0) == 0)
+            num_scenarios = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--spread=", 0) == 0)
+            spread = min(0.99, max(0.0, stod(arg.substr(9))));
+        else if (arg.rfind("--target=", 0) == 0)
+            target = min(1.0, max(0.0, stod(arg.substr(9))));
+        else if (arg.rfind("--particles=", 0) == 0)
+            particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            iterations = max(1, stoi(arg.substr(13)));
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int n, m;
+    cout << "Enter number of outposts: ";
+    cin >> n;
+    cout << "Enter number of UAVs: ";
+    cin >> m;
+
+    vector<UAV> uavs(m);
+    vector<Outpost> outposts(n);
+    BaseStation base;
+
+    // Input UAV details
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < m; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weight_capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    // Base first: the priority calculation needs it
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> base.x >> base.y;
+
+    // Input Outpost details
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < n; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+    if (n == 0 || m == 0)
+    {
+        cout << "\nNothing to allocate.\n";
+        return 0;
+    }
+
+    Problem pr;
+    for (const auto &outpost : outposts)
+    {
+        pr.distance.push_back(calculateDistance(base.x, base.y, outpost.x, outpost.y));
+        pr.weight.push_back(1.0 / max(1e-9, calculatePriority(outpost, base)));
+        pr.demand.push_back(outpost.medicine + outpost.food + outpost.weapons);
+    }
+    for (const auto &uav : uavs)
+    {
+        pr.energy_per_km.push_back(uav.energy_per_km);
+        pr.total_energy.push_back(uav.total_energy);
+        pr.capacity.push_back(uav.weight_capacity);
+    }
+
+    mt19937 rng(seed);
+    mt19937_64 scenario_rng(seed ^ 0x5ce7a7105ULL);
+    auto start = chrono::steady_clock::now();
+    Scenarios scenarios = sampleScenarios(m, n, num_scenarios, spread, scenario_rng);
+    Objective objective{pr, robust ? &scenarios : nullptr, target};
+    vector<int> best_allocation = pso(objective, m, n, particles, iterations, threads, rng);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Output best UAV allocation
+    cout << "\nBest UAV Allocation:\n";
+    for (size_t i = 0; i < best_allocation.size(); i++)
+    {
+        cout << "UAV " << uavs[i].id << " assigned to Outpost " << outposts[best_allocation[i]].id << "\n";
+    }
+
+    // Every plan is checked against the scenarios, whichever objective chose it
+    RobustScratch scratch;
+    RobustScore score = robustScore(best_allocation, pr, scenarios, scratch);
+    double point = fitnessFunction(best_allocation, pr);
+    cout << "Objective: " << (robust ? "robust" : "point estimate") << " | Solve Time: " << seconds << " s\n";
+    cout << "Point Energy Cost: ";
+    if (point >= SHORTFALL_PENALTY / m)
+        cout << "infeasible\n";
+    else
+        cout << point << "\n";
+    cout << "Expected Energy Cost: " << score.expected_cost << " over " << num_scenarios << " scenarios (±"
+         << spread * 100 << "%)\n";
+    cout << "Feasibility Probability: " << score.feasibility * 100 << "% | Expected Failed Deliveries: "
+         << score.expected_failures << "\n";
+
+    return 0;
+}
@@ -0,0 +1,910 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <unordered_map>
+
+using namespace std;
+
+const double UAV_SPEED = 10.0;        // Same as v8
+const double TICKS_PER_UNIT = 1e6;    // Simulated time is kept in integer ticks
+const double COORD_SCALE = 1000.0;    // Request positions are logged in 1/1000 units
+const size_t PENDING_SCAN = 64;       // Queued requests examined per priority when a UAV frees up
+const int DECISION_SAMPLE = 64;       // Time one dispatch decision in this many
+const uint64_t LATE_TOLERANCE = 100;  // Ticks; absorbs rounding of the plan's floating-point times
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+uint64_t toTicks(double time)
+{
+    return time <= 0 ? 0 : (uint64_t)llround(time * TICKS_PER_UNIT);
+}
+
+// ---------------------------------------------------------------------------
+// Radix heap: a monotone priority queue for integer keys. Keys popped never
+// decrease, which holds for a simulation clock, so each key only moves to a
+// lower bucket when the minimum changes: push is O(1) and pop is amortised
+// O(log C) with no comparisons between entries. Bucket 0 holds entries equal
+// to the last popped key and is read front to back, so equal keys come out in
+// insertion order, the same as the binary heap below with its sequence number.
+// ---------------------------------------------------------------------------
+
+template <typename T>
+class RadixHeap
+{
+public:
+    bool empty() const { return count == 0; }
+
+    void push(uint64_t key, const T &value)
+    {
+        buckets[bucketFor(key)].push_back({key, value});
+        count++;
+    }
+
+    pair<uint64_t, T> pop()
+    {
+        if (head == buckets[0].size())
+            refill();
+        count--;
+        const Entry &e = buckets[0][head++];
+        return {e.key, e.value};
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        T value;
+    };
+
+    int bucketFor(uint64_t key) const { return key == last ? 0 : 64 - __builtin_clzll(key ^ last); }
+
+    // Move the smallest non-empty bucket down, relative to its minimum key
+    void refill()
+    {
+        buckets[0].clear();
+        head = 0;
+        int i = 1;
+        while (buckets[i].empty())
+            i++;
+        last = buckets[i][0].key;
+        for (const auto &e : buckets[i])
+            last = min(last, e.key);
+        for (const auto &e : buckets[i])
+            buckets[bucketFor(e.key)].push_back(e);
+        buckets[i].clear();
+    }
+
+    array<vector<Entry>, 65> buckets;
+    uint64_t last = 0;
+    size_t head = 0, count = 0;
+};
+
+// std::priority_queue with the same interface, for comparison (--queue=binary)
+template <typename T>
+class BinaryHeap
+{
+public:
+    bool empty() const { return heap.empty(); }
+
+    void push(uint64_t key, const T &value) { heap.push({key, seq++, value}); }
+
+    pair<uint64_t, T> pop()
+    {
+        Entry e = heap.top();
+        heap.pop();
+        return {e.key, e.value};
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t key, seq;
+        T value;
+        bool operator>(const Entry &o) const { return key != o.key ? key > o.key : seq > o.seq; }
+    };
+    priority_queue<Entry, vector<Entry>, greater<Entry>> heap;
+    uint64_t seq = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Incoming requests and where they come from
+// ---------------------------------------------------------------------------
+
+// A delivery request arriving while the simulation runs. Time and position are
+// quantized on arrival, so a live run and a replay of its log are identical.
+struct Request
+{
+    uint64_t tick;
+    int id;
+    int medicine, food, weapons;
+    int64_t x, y; // In 1/COORD_SCALE units
+    int priority;
+};
+
+class RequestSource
+{
+public:
+    virtual ~RequestSource() = default;
+    virtual bool next(Request &r) = 0;
+};
+
+// Text lines: time id medicine food weapons x y priority
+class TextSource : public RequestSource
+{
+public:
+    explicit TextSource(const string &path) : file(path) {}
+    bool ok() const { return (bool)file; }
+
+    bool next(Request &r) override
+    {
+        double time, x, y;
+        if (!(file >> time >> r.id >> r.medicine >> r.food >> r.weapons >> x >> y >> r.priority))
+            return false;
+        r.tick = toTicks(time);
+        r.x = llround(x * COORD_SCALE);
+        r.y = llround(y * COORD_SCALE);
+        return true;
+    }
+
+private:
+    ifstream file;
+};
+
+// Poisson arrivals at `rate` per time unit, uniform over a box
+class GeneratedSource : public RequestSource
+{
+public:
+    GeneratedSource(long long total, double rate, double minX, double minY, double maxX, double maxY, int firstId,
+                    unsigned seed)
+        : remaining(total), gap(rate), x(minX, maxX), y(minY, maxY), firstId(firstId), rng(seed)
+    {
+    }
+
+    bool next(Request &r) override
+    {
+        if (remaining-- <= 0)
+            return false;
+        clock += gap(rng);
+        r.tick = toTicks(clock);
+        r.id = firstId++;
+        r.medicine = rng() % 20;
+        r.food = rng() % 20;
+        r.weapons = rng() % 20;
+        r.x = llround(x(rng) * COORD_SCALE);
+        r.y = llround(y(rng) * COORD_SCALE);
+        r.priority = 1 + rng() % 5;
+        return true;
+    }
+
+private:
+    long long remaining;
+    exponential_distribution<double> gap;
+    uniform_real_distribution<double> x, y;
+    int firstId;
+    mt19937_64 rng;
+    double clock = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Event log. Header "UAVE" + uint32 version, then one record per request:
+// zigzag varint deltas of time in ticks and of id, varint medicine, food,
+// weapons, zigzag varint x and y deltas, one priority byte. Deltas against
+// the previous record keep typical records at 10-14 bytes.
+// ---------------------------------------------------------------------------
+
+class LogWriter
+{
+public:
+    explicit LogWriter(FILE *out) : out(out)
+    {
+        fwrite("UAVE", 1, 4, out);
+        uint32_t version = 1;
+        fwrite(&version, sizeof(version), 1, out);
+        bytes = 8;
+    }
+    ~LogWriter() { flush(); }
+
+    void write(const Request &r)
+    {
+        if (buffer.size() > (1 << 16))
+            flush();
+        putVarint(zigzag((int64_t)(r.tick - prev.tick)));
+        putVarint(zigzag((int64_t)r.id - prev.id));
+        putVarint(r.medicine);
+        putVarint(r.food);
+        putVarint(r.weapons);
+        putVarint(zigzag(r.x - prev.x));
+        putVarint(zigzag(r.y - prev.y));
+        buffer.push_back((char)r.priority);
+        prev = r;
+        records++;
+    }
+
+    void flush()
+    {
+        fwrite(buffer.data(), 1, buffer.size(), out);
+        bytes += buffer.size();
+        buffer.clear();
+        fflush(out);
+    }
+
+    long long records = 0, bytes = 0;
+
+private:
+    static uint64_t zigzag(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+
+    void putVarint(uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            buffer.push_back((char)(v | 0x80));
+            v >>= 7;
+        }
+        buffer.push_back((char)v);
+    }
+
+    FILE *out;
+    vector<char> buffer;
+    Request prev{0, 0, 0, 0, 0, 0, 0, 0};
+};
+
+class LogSource : public RequestSource
+{
+public:
+    explicit LogSource(FILE *in) : in(in)
+    {
+        char magic[4];
+        uint32_t version = 0;
+        valid = fread(magic, 1, 4, in) == 4 && equal(magic, magic + 4, "UAVE") &&
+                fread(&version, sizeof(version), 1, in) == 1 && version == 1;
+    }
+    bool ok() const { return valid; }
+
+    bool next(Request &r) override
+    {
+        uint64_t dt, id, med, food, weap, dx, dy;
+        if (!getVarint(dt))
+            return false;
+        if (!getVarint(id) || !getVarint(med) || !getVarint(food) || !getVarint(weap) || !getVarint(dx) ||
+            !getVarint(dy))
+            return truncated();
+        int priority = getc(in);
+        if (priority == EOF)
+            return truncated();
+        r.tick = prev.tick + unzigzag(dt);
+        r.id = (int)(prev.id + unzigzag(id));
+        r.medicine = med;
+        r.food = food;
+        r.weapons = weap;
+        r.x = prev.x + unzigzag(dx);
+        r.y = prev.y + unzigzag(dy);
+        r.priority = priority;
+        prev = r;
+        return true;
+    }
+
+    bool wasTruncated() const { return cut; }
+
+private:
+    static int64_t unzigzag(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1); }
+
+    bool getVarint(uint64_t &v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            int c = getc(in);
+            if (c == EOF)
+                return false;
+            v |= (uint64_t)(c & 0x7f) << shift;
+            if (!(c & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    bool truncated()
+    {
+        cut = true;
+        return false;
+    }
+
+    FILE *in;
+    bool valid = false, cut = false;
+    Request prev{0, 0, 0, 0, 0, 0, 0, 0};
+};
+
+// Passes requests through from another source, logging each one
+class RecordingSource : public RequestSource
+{
+public:
+    RecordingSource(RequestSource &inner, LogWriter &log) : inner(inner), log(log) {}
+
+    bool next(Request &r) override
+    {
+        if (!inner.next(r))
+            return false;
+        log.write(r);
+        return true;
+    }
+
+private:
+    RequestSource &inner;
+    LogWriter &log;
+};
+
+// ---------------------------------------------------------------------------
+// Simulation
+// ---------------------------------------------------------------------------
+
+// Planned sortie from a v9 CSV plan
+struct Sortie
+{
+    uint64_t departTick;
+    int job;
+};
+
+// A delivery to perform: a planned outpost or an incoming request
+struct Job
+{
+    double distance;
+    int outpostId;
+    int priority;
+    uint64_t released; // Tick the job became known
+    bool planned;
+};
+
+enum EventType : uint8_t
+{
+    PLAN_DEPART, // UAV a is due to fly its next planned sortie
+    ARRIVE,      // UAV a reaches the outpost of job b
+    RETURN,      // UAV a is back at base
+    REQUEST,     // The next incoming request is due
+};
+
+struct Event
+{
+    EventType type;
+    int a, b;
+};
+
+struct SimStats
+{
+    long long events = 0;
+    long long plannedFlown = 0, plannedLate = 0;
+    double plannedDelay = 0;
+    long long received = 0, delivered = 0, rejected = 0, outOfOrder = 0;
+    vector<double> latency;        // Request to delivery, simulated time
+    vector<double> decisionNanos;  // Sampled wall time per dispatch decision
+    uint64_t endTick = 0;
+};
+
+template <template <typename> class Queue>
+class Simulator
+{
+public:
+    Simulator(const vector<UAV> &uavs, double baseX, double baseY, vector<Job> jobs, vector<vector<Sortie>> plans,
+              RequestSource *requests, double speed)
+        : uavs(uavs), baseX(baseX), baseY(baseY), jobs(move(jobs)), plans(move(plans)), requests(requests),
+          speed(speed), busy(uavs.size(), false), nextSortie(uavs.size(), 0), idlePos(uavs.size(), -1)
+    {
+        for (const auto &uav : uavs)
+            maxRange = max(maxRange, uav.totalEnergy / max(1e-12, uav.energyPerKm) / 2);
+    }
+
+    SimStats run()
+    {
+        wallStart = chrono::steady_clock::now();
+        for (size_t u = 0; u < uavs.size(); u++)
+        {
+            if (!plans[u].empty())
+                queue.push(plans[u][0].departTick, {PLAN_DEPART, (int)u, 0});
+            makeIdle(u);
+        }
+        pullRequest(0);
+
+        while (!queue.empty())
+        {
+            auto [tick, event] = queue.pop();
+            now = tick;
+            stats.events++;
+            switch (event.type)
+            {
+            case PLAN_DEPART:
+                // A UAV still out on an earlier sortie flies this one when it returns
+                if (!busy[event.a])
+                    flyPlanned(event.a);
+                break;
+            case ARRIVE:
+                deliver(event.b);
+                break;
+            case RETURN:
+                returned(event.a);
+                break;
+            case REQUEST:
+                arrive(event.a);
+                pullRequest(now);
+                break;
+            }
+        }
+        stats.endTick = now;
+        return move(stats);
+    }
+
+    size_t pendingCount() const
+    {
+        size_t total = 0;
+        for (const auto &p : pending)
+            total += p.size() - pendingHead[&p - pending.data()];
+        return total;
+    }
+
+private:
+    uint64_t roundTripTicks(int job) const { return toTicks(2 * jobs[job].distance / UAV_SPEED); }
+
+    bool canReach(int u, int job) const
+    {
+        return jobs[job].distance * uavs[u].energyPerKm * 2 <= uavs[u].totalEnergy; // Round trip, as v8
+    }
+
+    // An idle UAV may take a request if it is back before its next planned sortie
+    bool fitsBeforePlan(int u, int job) const
+    {
+        if (nextSortie[u] >= plans[u].size())
+            return true;
+        return now + roundTripTicks(job) <= plans[u][nextSortie[u]].departTick;
+    }
+
+    void launch(int u, int job)
+    {
+        unmakeIdle(u);
+        busy[u] = true;
+        uint64_t oneWay = toTicks(jobs[job].distance / UAV_SPEED);
+        queue.push(now + oneWay, {ARRIVE, u, job});
+        queue.push(now + roundTripTicks(job), {RETURN, u, 0});
+    }
+
+    void flyPlanned(int u)
+    {
+        const Sortie &s = plans[u][nextSortie[u]++];
+        if (now > s.departTick + LATE_TOLERANCE)
+        {
+            stats.plannedLate++;
+            stats.plannedDelay += (now - s.departTick) / TICKS_PER_UNIT;
+        }
+        stats.plannedFlown++;
+        launch(u, s.job);
+    }
+
+    void deliver(int job)
+    {
+        if (!jobs[job].planned)
+        {
+            stats.delivered++;
+            stats.latency.push_back((now - jobs[job].released) / TICKS_PER_UNIT);
+        }
+    }
+
+    void returned(int u)
+    {
+        busy[u] = false;
+        if (nextSortie[u] < plans[u].size())
+        {
+            uint64_t due = plans[u][nextSortie[u]].departTick;
+            if (due <= now)
+            {
+                flyPlanned(u);
+                return;
+            }
+            queue.push(due, {PLAN_DEPART, u, 0});
+        }
+        // Queued requests, highest priority first, oldest first within a priority
+        for (int p = (int)pending.size() - 1; p >= 0; p--)
+        {
+            auto &q = pending[p];
+            size_t &head = pendingHead[p];
+            for (size_t k = head; k < q.size() && k < head + PENDING_SCAN; k++)
+            {
+                int job = q[k];
+                if (canReach(u, job) && fitsBeforePlan(u, job))
+                {
+                    swap(q[k], q[head]);
+                    head++;
+                    if (head == q.size())
+                        q.clear(), head = 0;
+                    launch(u, job);
+                    return;
+                }
+            }
+        }
+        makeIdle(u);
+    }
+
+    void arrive(int job)
+    {
+        bool timed = stats.received % DECISION_SAMPLE == 0;
+        auto start = timed ? chrono::steady_clock::now() : chrono::steady_clock::time_point{};
+        stats.received++;
+        if (jobs[job].distance > maxRange)
+            stats.rejected++; // No UAV in the fleet can reach it
+        else
+        {
+            int chosen = -1;
+            for (int u : idle)
+                if (canReach(u, job) && fitsBeforePlan(u, job))
+                {
+                    chosen = u;
+                    break;
+                }
+            if (chosen >= 0)
+                launch(chosen, job);
+            else
+                pending[min(max(jobs[job].priority, 1), 5) - 1].push_back(job);
+        }
+        if (timed)
+            stats.decisionNanos.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+    }
+
+    // Requests enter one at a time, so the queue never holds the whole stream
+    void pullRequest(uint64_t notBefore)
+    {
+        Request r;
+        if (!requests || !requests->next(r))
+            return;
+        if (r.tick < notBefore)
+        {
+            stats.outOfOrder++;
+            r.tick = notBefore;
+        }
+        if (speed > 0)
+            this_thread::sleep_until(wallStart + chrono::duration<double>(r.tick / TICKS_PER_UNIT / speed));
+        double x = r.x / COORD_SCALE, y = r.y / COORD_SCALE;
+        jobs.push_back({calculateDistance(baseX, baseY, x, y), r.id, r.priority, r.tick, false});
+        queue.push(r.tick, {REQUEST, (int)jobs.size() - 1, 0});
+    }
+
+    void makeIdle(int u)
+    {
+        if (idlePos[u] >= 0)
+            return;
+        idlePos[u] = idle.size();
+        idle.push_back(u);
+    }
+
+    void unmakeIdle(int u)
+    {
+        if (idlePos[u] < 0)
+            return;
+        int last = idle.back();
+        idle[idlePos[u]] = last;
+        idlePos[last] = idlePos[u];
+        idle.pop_back();
+        idlePos[u] = -1;
+    }
+
+    const vector<UAV> &uavs;
+    double baseX, baseY;
+    vector<Job> jobs;
+    vector<vector<Sortie>> plans;
+    RequestSource *requests;
+    double speed; // Simulated units per wall second; 0 = as fast as possible
+    double maxRange = 0;
+
+    Queue<Event> queue;
+    uint64_t now = 0;
+    vector<bool> busy;
+    vector<size_t> nextSortie;
+    vector<int> idle, idlePos;
+    array<vector<int>, 5> pending;
+    array<size_t, 5> pendingHead{};
+    SimStats stats;
+    chrono::steady_clock::time_point wallStart;
+};
+
+// Reads the v9 CSV (uav_id,outpost_id,distance,energy_cost,travel_time,available_again).
+// Unreachable rows (empty uav_id) and unknown ids are skipped.
+bool loadPlan(const string &path, const vector<UAV> &uavs, const vector<Outpost> &outposts, double baseX,
+              double baseY, vector<Job> &jobs, vector<vector<Sortie>> &plans, long long &skipped)
+{
+    ifstream file(path);
+    if (!file)
+        return false;
+    unordered_map<int, int> uavIndex, outpostIndex;
+    for (size_t i = 0; i < uavs.size(); i++)
+        uavIndex[uavs[i].id] = i;
+    for (size_t i = 0; i < outposts.size(); i++)
+        outpostIndex[outposts[i].id] = i;
+
+    string line;
+    getline(file, line); // Header
+    while (getline(file, line))
+    {
+        const char *p = line.c_str();
+        char *end;
+        long uavId = strtol(p, &end, 10);
+        bool hasUav = end != p;
+        if (*end != ',')
+        {
+            skipped++;
+            continue;
+        }
+        long outpostId = strtol(end + 1, &end, 10);
+        // Skip distance and energy_cost; travel_time and available_again remain
+        for (int field = 0; field < 2 && end; field++)
+            end = strchr(end + 1, ',');
+        double travelTime = 0, availableAgain = 0;
+        if (end)
+            travelTime = strtod(end + 1, &end);
+        if (end && *end == ',')
+            availableAgain = strtod(end + 1, &end);
+        else
+            end = nullptr;
+
+        auto u = uavIndex.find(uavId);
+        auto o = outpostIndex.find(outpostId);
+        if (!hasUav || !end || u == uavIndex.end() || o == outpostIndex.end())
+        {
+            skipped++;
+            continue;
+        }
+        const Outpost &outpost = outposts[o->second];
+        jobs.push_back({calculateDistance(baseX, baseY, outpost.x, outpost.y), outpost.id, outpost.priority, 0, true});
+        plans[u->second].push_back({toTicks(availableAgain - 2 * travelTime), (int)jobs.size() - 1});
+    }
+    for (auto &plan : plans)
+        stable_sort(plan.begin(), plan.end(), [](const Sortie &a, const Sortie &b) { return a.departTick < b.departTick; });
+    return true;
+}
+
+double percentile(vector<double> &values, double q)
+{
+    if (values.empty())
+        return 0;
+    size_t k = min(values.size() - 1, (size_t)(q * values.size()));
+    nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --plan=FILE (v9 csv)  --events=FILE | --replay=LOG | --generate=N [--rate=R]
+    //          --record=LOG  --speed=X  --queue=radix|binary  --seed=S
+    string planPath, eventsPath, replayPath, recordPath, queueKind = "radix";
+    long long generate = 0;
+    double rate = 100.0, speed = 0.0;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--plan=", 0) == 0)
+            planPath = arg.substr(7);
+        else if (arg.rfind("--events=", 0) == 0)
+            eventsPath = arg.substr(9);
+        else if (arg.rfind("--replay=", 0) == 0)
+            replayPath = arg.substr(9);
+        else if (arg.rfind("--generate=", 0) == 0)
+            generate = stoll(arg.substr(11));
+        else if (arg.rfind("--rate=", 0) == 0)
+            rate = stod(arg.substr(7));
+        else if (arg.rfind("--record=", 0) == 0)
+            recordPath = arg.substr(9);
+        else if (arg.rfind("--speed=", 0) == 0)
+            speed = max(0.0, stod(arg.substr(8)));
+        else if (arg == "--queue=radix" || arg == "--queue=binary")
+            queueKind = arg.substr(8);
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoul(arg.substr(7));
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (!eventsPath.empty() + !replayPath.empty() + (generate > 0) > 1)
+    {
+        cerr << "Use only one of --events, --replay and --generate\n";
+        return 1;
+    }
+    if (!(rate > 0))
+    {
+        cerr << "--rate must be positive\n";
+        return 1;
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+    cout << "\n";
+
+    vector<Job> jobs;
+    vector<vector<Sortie>> plans(numUAVs);
+    long long skippedRows = 0;
+    if (!planPath.empty() && !loadPlan(planPath, uavs, outposts, baseX, baseY, jobs, plans, skippedRows))
+    {
+        cerr << "Cannot open plan: " << planPath << "\n";
+        return 1;
+    }
+
+    // Request source, optionally recorded
+    unique_ptr<RequestSource> source;
+    FILE *replayFile = nullptr;
+    if (!eventsPath.empty())
+    {
+        auto text = make_unique<TextSource>(eventsPath);
+        if (!text->ok())
+        {
+            cerr << "Cannot open events: " << eventsPath << "\n";
+            return 1;
+        }
+        source = move(text);
+    }
+    else if (!replayPath.empty())
+    {
+        replayFile = fopen(replayPath.c_str(), "rb");
+        if (!replayFile)
+        {
+            cerr << "Cannot open log: " << replayPath << "\n";
+            return 1;
+        }
+        auto log = make_unique<LogSource>(replayFile);
+        if (!log->ok())
+        {
+            cerr << "Not an event log: " << replayPath << "\n";
+            return 1;
+        }
+        source = move(log);
+    }
+    else if (generate > 0)
+    {
+        // Requests land in the outposts' bounding box (or around the base)
+        double minX = baseX - 100, maxX = baseX + 100, minY = baseY - 100, maxY = baseY + 100;
+        int firstId = 1;
+        if (!outposts.empty())
+        {
+            minX = minY = numeric_limits<double>::max();
+            maxX = maxY = numeric_limits<double>::lowest();
+        }
+        for (const auto &o : outposts)
+        {
+            minX = min(minX, o.x), maxX = max(maxX, o.x), minY = min(minY, o.y), maxY = max(maxY, o.y);
+            firstId = max(firstId, o.id + 1);
+        }
+        source = make_unique<GeneratedSource>(generate, rate, minX, minY, maxX, maxY, firstId, seed);
+    }
+
+    FILE *recordFile = nullptr;
+    unique_ptr<LogWriter> logWriter;
+    unique_ptr<RecordingSource> recording;
+    RequestSource *requests = source.get();
+    if (!recordPath.empty() && source)
+    {
+        recordFile = fopen(recordPath.c_str(), "wb");
+        if (!recordFile)
+        {
+            cerr << "Cannot open log for writing: " << recordPath << "\n";
+            return 1;
+        }
+        logWriter = make_unique<LogWriter>(recordFile);
+        recording = make_unique<RecordingSource>(*source, *logWriter);
+        requests = recording.get();
+    }
+
+    auto start = chrono::steady_clock::now();
+    SimStats stats;
+    size_t pending;
+    if (queueKind == "radix")
+    {
+        Simulator<RadixHeap> sim(uavs, baseX, baseY, jobs, plans, requests, speed);
+        stats = sim.run();
+        pending = sim.pendingCount();
+    }
+    else
+    {
+        Simulator<BinaryHeap> sim(uavs, baseX, baseY, jobs, plans, requests, speed);
+        stats = sim.run();
+        pending = sim.pendingCount();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Simulated to t = " << stats.endTick / TICKS_PER_UNIT << " | Events: " << stats.events << " in "
+         << seconds << " s (" << (seconds > 0 ? stats.events / seconds : 0) << " events/s, " << queueKind
+         << " queue)\n";
+    cout << "Planned sorties: " << stats.plannedFlown << " flown, " << stats.plannedLate << " late (total delay "
+         << stats.plannedDelay << ")";
+    if (skippedRows)
+        cout << ", " << skippedRows << " plan rows skipped";
+    cout << "\n";
+    cout << "Requests: " << stats.received << " received, " << stats.delivered << " delivered, " << stats.rejected
+         << " out of range, " << pending << " still queued";
+    if (stats.outOfOrder)
+        cout << ", " << stats.outOfOrder << " out of order";
+    cout << "\n";
+    if (!stats.latency.empty())
+    {
+        double mean = 0;
+        for (double l : stats.latency)
+            mean += l / stats.latency.size();
+        double p50 = percentile(stats.latency, 0.5), p99 = percentile(stats.latency, 0.99);
+        double worst = *max_element(stats.latency.begin(), stats.latency.end());
+        cout << "Request to delivery: mean " << mean << " | p50 " << p50 << " | p99 " << p99 << " | max " << worst
+             << "\n";
+    }
+    if (!stats.decisionNanos.empty())
+    {
+        double p50 = percentile(stats.decisionNanos, 0.5), p99 = percentile(stats.decisionNanos, 0.99);
+        cout << "Dispatch decision (1 in " << DECISION_SAMPLE << " timed): p50 " << p50 << " ns | p99 " << p99
+             << " ns\n";
+    }
+    if (logWriter)
+    {
+        logWriter->flush();
+        cout << "Recorded " << logWriter->records << " requests to " << recordPath << " (" << logWriter->bytes
+             << " bytes, " << (logWriter->records ? (double)(logWriter->bytes - 8) / logWriter->records : 0)
+             << " bytes/request)\n";
+        logWriter.reset();
+        fclose(recordFile);
+    }
+    if (replayFile)
+    {
+        if (static_cast<LogSource *>(source.get())->wasTruncated())
+            cerr << "Warning: event log ends in the middle of a record\n";
+        fclose(replayFile);
+    }
+
+    return 0;
+}
@@ -0,0 +1,499 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <chrono>
+#include <unordered_map>
+
+using namespace std;
+
+const double UAV_SPEED = 10.0; // Same as v8
+const int CANDIDATE_MOVES = 4;  // Rebalancing moves scored with the full scheduler per round
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    int homeDepot; // Index into the depot list
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+struct Depot
+{
+    int id;
+    double x, y;
+};
+
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time; // Min-heap based on time
+    }
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Runs work(t) for t in [0, threads); inline when there is one thread
+template <typename Work>
+void runThreads(int threads, Work work)
+{
+    if (threads == 1)
+    {
+        work(0);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.emplace_back(work, t);
+    for (auto &w : workers)
+        w.join();
+}
+
+// ---------------------------------------------------------------------------
+// Depot tables, built once and shared read-only by every solver: one
+// contiguous row of outpost distances per depot, plus depot-to-depot
+// distances for relocating UAVs.
+// ---------------------------------------------------------------------------
+
+struct DepotTable
+{
+    size_t numDepots, numOutposts;
+    vector<double> distance;      // [depot * numOutposts + outpost]
+    vector<double> depotDistance; // [depot * numDepots + depot]
+
+    const double *row(int depot) const { return &distance[depot * numOutposts]; }
+};
+
+// Outposts are split into contiguous ranges, one per thread; each thread
+// fills its range of every depot row
+DepotTable buildDepotTable(const vector<Depot> &depots, const vector<Outpost> &outposts, int threads)
+{
+    DepotTable table{depots.size(), outposts.size(), vector<double>(depots.size() * outposts.size()),
+                     vector<double>(depots.size() * depots.size())};
+    size_t chunk = (outposts.size() + threads - 1) / threads;
+    runThreads(threads, [&](int t)
+               {
+                   size_t first = t * chunk, last = min(outposts.size(), first + chunk);
+                   for (size_t d = 0; d < depots.size(); d++)
+                   {
+                       double *row = &table.distance[d * outposts.size()];
+                       for (size_t o = first; o < last; o++)
+                           row[o] = calculateDistance(depots[d].x, depots[d].y, outposts[o].x, outposts[o].y);
+                   } });
+    for (size_t a = 0; a < depots.size(); a++)
+        for (size_t b = 0; b < depots.size(); b++)
+            table.depotDistance[a * depots.size() + b] =
+                calculateDistance(depots[a].x, depots[a].y, depots[b].x, depots[b].y);
+    return table;
+}
+
+// ---------------------------------------------------------------------------
+// v8 scheduling across depots. Each depot keeps its own min-heap of UAVs by
+// available time. For an outpost, the v8 pop loop finds each depot's earliest
+// available UAV that can make the round trip; all UAVs at one depot fly the
+// same distance, so that UAV also finishes first there. The outpost goes to
+// whichever depot's candidate finishes first (then lower energy).
+// ---------------------------------------------------------------------------
+
+struct Dispatch
+{
+    int uav, outpost, depot;
+    double distance, energyCost, travelTime, availableAgain;
+};
+
+struct Schedule
+{
+    vector<Dispatch> dispatches;
+    vector<int> unreachable; // Outpost indices
+    double makespan = 0, totalEnergy = 0;
+    vector<double> depotFinish; // Latest return per depot
+    vector<double> depotLoad;   // Total sortie time flown from each depot
+
+    // Serve more outposts, then finish sooner, then use less energy
+    bool betterThan(const Schedule &o) const
+    {
+        if (unreachable.size() != o.unreachable.size())
+            return unreachable.size() < o.unreachable.size();
+        if (makespan != o.makespan)
+            return makespan < o.makespan - 1e-9;
+        return totalEnergy < o.totalEnergy - 1e-9;
+    }
+};
+
+// Fleet layout: each UAV's depot, the time it can first fly from there, and
+// the energy spent getting there (zero unless relocated)
+struct Placement
+{
+    vector<int> depot;
+    vector<double> ready, ferryEnergy;
+};
+
+Placement homePlacement(const vector<UAV> &uavs)
+{
+    Placement p{vector<int>(uavs.size()), vector<double>(uavs.size(), 0), vector<double>(uavs.size(), 0)};
+    for (size_t u = 0; u < uavs.size(); u++)
+        p.depot[u] = uavs[u].homeDepot;
+    return p;
+}
+
+// `order` lists outpost indices by descending priority. With `nearest`, each
+// outpost may only be served from its nearest depot (one solver per base).
+Schedule schedule(const vector<UAV> &uavs, const Placement &placement, const vector<int> &order,
+                  const DepotTable &table, bool record, const vector<int> *nearest = nullptr)
+{
+    size_t numDepots = table.numDepots;
+    vector<priority_queue<Task, vector<Task>, greater<Task>>> heaps(numDepots);
+    Schedule result;
+    result.depotFinish.assign(numDepots, 0);
+    result.depotLoad.assign(numDepots, 0);
+    // Longest round trip radius per depot, to skip depots that cannot reach
+    // an outpost without popping their whole heap
+    vector<double> maxRange(numDepots, -1);
+    for (size_t u = 0; u < uavs.size(); u++)
+    {
+        int d = placement.depot[u];
+        heaps[d].push({placement.ready[u], (int)u});
+        maxRange[d] = max(maxRange[d], uavs[u].totalEnergy / (2 * uavs[u].energyPerKm));
+        result.totalEnergy += placement.ferryEnergy[u];
+    }
+
+    vector<vector<Task>> skipped(numDepots); // Popped but unable to reach, per depot
+    for (int o : order)
+    {
+        int bestDepot = -1;
+        Task best{numeric_limits<double>::max(), -1};
+        double bestEnergy = 0;
+        for (size_t d = 0; d < numDepots; d++)
+        {
+            if (nearest && (*nearest)[o] != (int)d)
+                continue;
+            auto &pq = heaps[d];
+            double distance = table.row(d)[o];
+            if (distance > maxRange[d])
+                continue;
+            while (!pq.empty())
+            {
+                Task task = pq.top();
+                double energyCost = distance * uavs[task.uavIndex].energyPerKm * 2; // Round trip
+                if (energyCost <= uavs[task.uavIndex].totalEnergy)
+                {
+                    double finish = task.time + 2 * distance / UAV_SPEED;
+                    if (finish < best.time || (finish == best.time && energyCost < bestEnergy))
+                    {
+                        best = {finish, task.uavIndex};
+                        bestDepot = d;
+                        bestEnergy = energyCost;
+                    }
+                    break;
+                }
+                skipped[d].push_back(task);
+                pq.pop();
+            }
+        }
+
+        // The chosen UAV is still on top of its depot's heap
+        if (bestDepot >= 0)
+        {
+            heaps[bestDepot].pop();
+            heaps[bestDepot].push(best);
+        }
+
+        // Push back UAVs that were not selected
+        for (size_t d = 0; d < numDepots; d++)
+        {
+            for (auto &task : skipped[d])
+                heaps[d].push(task);
+            skipped[d].clear();
+        }
+
+        if (bestDepot < 0)
+        {
+            result.unreachable.push_back(o);
+            continue;
+        }
+        double distance = table.row(bestDepot)[o];
+        result.totalEnergy += bestEnergy;
+        result.makespan = max(result.makespan, best.time);
+        result.depotFinish[bestDepot] = max(result.depotFinish[bestDepot], best.time);
+        result.depotLoad[bestDepot] += 2 * distance / UAV_SPEED;
+        if (record)
+            result.dispatches.push_back(
+                {best.uavIndex, o, bestDepot, distance, bestEnergy, distance / UAV_SPEED, best.time});
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Cross-depot rebalancing. A move sends one UAV from depot A to depot B,
+// flying there first (one-way energy, recharged on arrival). A full schedule
+// is too expensive to try every move, so (A, B) pairs are ranked by a load
+// model: depot d finishes around load[d] / fleet[d], where load is its total
+// sortie time. The best-ranked pairs, each with the longest-range UAV able to
+// make the ferry flight, are then scored with the real scheduler in parallel,
+// and the best one is kept while it improves the schedule.
+// ---------------------------------------------------------------------------
+
+struct Move
+{
+    int uav, to;
+};
+
+struct Relocation
+{
+    int uav, from, to;
+};
+
+int rebalance(const vector<UAV> &uavs, Placement &placement, const vector<int> &order, const DepotTable &table,
+              int maxMoves, int threads, Schedule &current, vector<Relocation> &log)
+{
+    int applied = 0;
+    size_t numDepots = table.numDepots;
+    int batch = max(threads, CANDIDATE_MOVES);
+    while (applied < maxMoves && numDepots > 1)
+    {
+        vector<int> fleet(numDepots, 0);
+        for (int d : placement.depot)
+            fleet[d]++;
+        auto finish = [&](int d, int uavs)
+        { return uavs > 0 ? current.depotLoad[d] / uavs : (current.depotLoad[d] > 0 ? 1e300 : 0.0); };
+        // The three latest depots are enough to know the peak without any two
+        vector<int> top(numDepots);
+        for (size_t d = 0; d < numDepots; d++)
+            top[d] = d;
+        size_t k = min<size_t>(3, numDepots);
+        partial_sort(top.begin(), top.begin() + k, top.end(),
+                     [&](int a, int b) { return finish(a, fleet[a]) > finish(b, fleet[b]); });
+        double worst = finish(top[0], fleet[top[0]]);
+
+        // Predicted fleet-wide peak after the move, lower is better
+        vector<pair<double, Move>> ranked;
+        for (size_t from = 0; from < numDepots; from++)
+        {
+            if (fleet[from] == 0)
+                continue;
+            for (size_t to = 0; to < numDepots; to++)
+            {
+                if (to == from)
+                    continue;
+                double peak = max(finish(from, fleet[from] - 1), finish(to, fleet[to] + 1));
+                for (size_t i = 0; i < k; i++)
+                    if (top[i] != (int)from && top[i] != (int)to)
+                    {
+                        peak = max(peak, finish(top[i], fleet[top[i]]));
+                        break;
+                    }
+                if (peak >= worst)
+                    continue;
+                int best = -1;
+                double ferry = table.depotDistance[from * numDepots + to];
+                for (size_t u = 0; u < uavs.size(); u++)
+                    if (placement.depot[u] == (int)from && ferry * uavs[u].energyPerKm <= uavs[u].totalEnergy &&
+                        (best < 0 || uavs[u].totalEnergy / uavs[u].energyPerKm >
+                                         uavs[best].totalEnergy / uavs[best].energyPerKm))
+                        best = u;
+                if (best >= 0)
+                    ranked.push_back({peak, {best, (int)to}});
+            }
+        }
+        if (ranked.empty())
+            break;
+        size_t keep = min<size_t>(batch, ranked.size());
+        partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+        ranked.resize(keep);
+
+        vector<Schedule> trial(keep);
+        int workers = min<int>(threads, keep);
+        runThreads(workers, [&](int t)
+                   {
+                       for (size_t i = t; i < keep; i += workers)
+                       {
+                           Placement p = placement;
+                           const Move &mv = ranked[i].second;
+                           double ferry = table.depotDistance[p.depot[mv.uav] * numDepots + mv.to];
+                           p.ready[mv.uav] += ferry / UAV_SPEED;
+                           p.ferryEnergy[mv.uav] += ferry * uavs[mv.uav].energyPerKm;
+                           p.depot[mv.uav] = mv.to;
+                           trial[i] = schedule(uavs, p, order, table, false);
+                       } });
+
+        int best = -1;
+        for (size_t i = 0; i < keep; i++)
+            if (trial[i].betterThan(best < 0 ? current : trial[best]))
+                best = i;
+        if (best < 0)
+            break;
+
+        const Move &mv = ranked[best].second;
+        double ferry = table.depotDistance[placement.depot[mv.uav] * numDepots + mv.to];
+        log.push_back({mv.uav, placement.depot[mv.uav], mv.to});
+        placement.ready[mv.uav] += ferry / UAV_SPEED;
+        placement.ferryEnergy[mv.uav] += ferry * uavs[mv.uav].energyPerKm;
+        placement.depot[mv.uav] = mv.to;
+        current = trial[best];
+        applied++;
+    }
+    return applied;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --threads=T  --moves=N  --no-rebalance  --isolated  --quiet
+    int threads = 1, maxMoves = 20;
+    bool quiet = false, isolated = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--moves=", 0) == 0)
+            maxMoves = max(0, stoi(arg.substr(8)));
+        else if (arg == "--no-rebalance")
+            maxMoves = 0;
+        else if (arg == "--isolated")
+            isolated = true;
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs, numDepots;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+    cout << "Enter number of depots: ";
+    cin >> numDepots;
+    if (numDepots < 1)
+    {
+        cerr << "At least one depot is required\n";
+        return 1;
+    }
+
+    vector<Depot> depots(numDepots);
+    unordered_map<int, int> depotIndex;
+    cout << "Enter Depot details (ID, x, y):\n";
+    for (int i = 0; i < numDepots; i++)
+    {
+        cin >> depots[i].id >> depots[i].x >> depots[i].y;
+        depotIndex[depots[i].id] = i;
+    }
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy, home depot ID):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        int depotId;
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy >> depotId;
+        auto it = depotIndex.find(depotId);
+        if (it == depotIndex.end())
+        {
+            cerr << "UAV " << uavs[i].id << " has unknown home depot " << depotId << "\n";
+            return 1;
+        }
+        uavs[i].homeDepot = it->second;
+    }
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >> outposts[i].y >> outposts[i].priority;
+    }
+
+    // Sort outposts by priority (descending), exactly as v8 does
+    sort(outposts.begin(), outposts.end(), [](const Outpost &a, const Outpost &b)
+         { return a.priority > b.priority; });
+
+    auto start = chrono::steady_clock::now();
+    DepotTable table = buildDepotTable(depots, outposts, threads);
+    double tableSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<int> order(numOutposts);
+    for (int o = 0; o < numOutposts; o++)
+        order[o] = o;
+
+    Placement placement = homePlacement(uavs);
+    vector<Relocation> relocations;
+    int moves = 0;
+    Schedule initial, final;
+    if (isolated)
+    {
+        // Baseline: every base plans alone for the outposts closest to it
+        vector<int> nearest(numOutposts, 0);
+        for (int o = 0; o < numOutposts; o++)
+            for (int d = 1; d < numDepots; d++)
+                if (table.row(d)[o] < table.row(nearest[o])[o])
+                    nearest[o] = d;
+        initial = final = schedule(uavs, placement, order, table, true, &nearest);
+    }
+    else
+    {
+        Schedule current = schedule(uavs, placement, order, table, false);
+        initial = current;
+        moves = rebalance(uavs, placement, order, table, maxMoves, threads, current, relocations);
+        final = schedule(uavs, placement, order, table, true);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (!quiet)
+    {
+        cout << "\nRelocations:\n";
+        for (const auto &r : relocations)
+            cout << "UAV " << uavs[r.uav].id << " moves from Depot " << depots[r.from].id << " to Depot "
+                 << depots[r.to].id << "\n";
+
+        cout << "\nBest UAV Allocation:\n";
+        for (const auto &d : final.dispatches)
+            cout << "UAV " << uavs[d.uav].id << " (Depot " << depots[d.depot].id << ") assigned to Outpost "
+                 << outposts[d.outpost].id << " | Distance: " << d.distance << " | Energy Cost: " << d.energyCost
+                 << " | Travel Time: " << d.travelTime << " | Available Again At: " << d.availableAgain << "\n";
+        for (int o : final.unreachable)
+            cout << "⚠️ Warning: Outpost " << outposts[o].id << " could not be reached due to UAV constraints.\n";
+    }
+
+    cout << "\nDepot Summary:\n";
+    vector<int> fleet(numDepots, 0), sorties(numDepots, 0);
+    for (int u = 0; u < numUAVs; u++)
+        fleet[placement.depot[u]]++;
+    for (const auto &d : final.dispatches)
+        sorties[d.depot]++;
+    for (int d = 0; d < numDepots; d++)
+        cout << "Depot " << depots[d].id << ": " << fleet[d] << " UAVs, " << sorties[d] << " sorties, finishes at "
+             << final.depotFinish[d] << "\n";
+
+    cout << "Assigned: " << final.dispatches.size() << " | Unreachable: " << final.unreachable.size()
+         << " | Total Energy: " << final.totalEnergy << " | Makespan: " << final.makespan << "\n";
+    cout << "Before rebalancing: Unreachable: " << initial.unreachable.size()
+         << " | Total Energy: " << initial.totalEnergy << " | Makespan: " << initial.makespan << " (" << moves
+         << " relocations)\n";
+    cout << "Depot tables: " << tableSeconds << " s | Total: " << seconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,373 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <chrono>
+
+using namespace std;
+
+const long long PRUNE_FACTOR = 4; // Prune the store when it holds more than this many candidates per UAV
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+struct Allocation
+{
+    int uavId;
+    int outpostId;
+    double energyCost;
+};
+
+// An outpost as the allocator sees it. `seq` is the arrival number: among
+// equal priorities the earlier request goes first, which makes the order
+// total and lets a stream reproduce the batch result exactly.
+struct Candidate
+{
+    int priority;
+    long long seq;
+    int id;
+    double distance;
+};
+
+// Processing order of v7: higher priority first, then earlier arrival
+bool before(const Candidate &a, const Candidate &b)
+{
+    if (a.priority != b.priority)
+        return a.priority > b.priority;
+    return a.seq < b.seq;
+}
+
+// ---------------------------------------------------------------------------
+// Capability classes. UAVs are grouped by range (total energy / energy per
+// km). Sorted by falling range, the classes that can reach an outpost are
+// always a prefix, and its length j is the outpost's class. Every outpost of
+// class j competes for the same N_j UAVs (those in the first j classes), and
+// v7 processes them in priority order, so only the first N_j of them can ever
+// be served: by the time a later one comes up, each earlier one has either
+// taken one of those UAVs or found them all taken. Keeping the best N_j per
+// class is therefore exact, and the total kept is at most Σ N_j.
+//
+// Σ N_j grows with the square of the fleet when every UAV has its own range,
+// so the store also prunes: whenever it holds more than PRUNE_FACTOR × fleet
+// candidates, it runs v7 over them and keeps only those that got a UAV. That
+// is exact too. Ranges are nested, so a new arrival, wherever it falls in the
+// order, can only take UAVs away from later outposts, never free one; an
+// outpost that found no UAV among the kept candidates never will. Dropping it
+// changes nothing for the others, since it took nothing. After a prune at most
+// one candidate per UAV is left, so memory is O(fleet) whatever the classes.
+// ---------------------------------------------------------------------------
+
+struct CapabilityClasses
+{
+    vector<double> range;     // Falling
+    vector<long long> reserve; // reserve[j]: UAVs able to serve class j (N_j), j >= 1
+
+    // Number of leading classes whose range covers the distance (0 = none)
+    int classOf(double distance) const
+    {
+        return upper_bound(range.begin(), range.end(), distance, [](double d, double r) { return d > r; }) -
+               range.begin();
+    }
+};
+
+double uavRange(const UAV &uav)
+{
+    return uav.totalEnergy / uav.energyPerKm;
+}
+
+CapabilityClasses buildClasses(const vector<UAV> &uavs)
+{
+    vector<double> ranges;
+    for (const auto &uav : uavs)
+        ranges.push_back(uavRange(uav));
+    sort(ranges.begin(), ranges.end(), greater<double>());
+
+    CapabilityClasses classes;
+    classes.reserve.push_back(0);
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        if (classes.range.empty() || ranges[i] != classes.range.back())
+        {
+            classes.range.push_back(ranges[i]);
+            classes.reserve.push_back(classes.reserve.back());
+        }
+        classes.reserve.back()++;
+    }
+    return classes;
+}
+
+// v7's "first unassigned UAV in input order that can reach it", in O(log M):
+// a max-tree of the ranges of the UAVs still free
+class FreeUAVs
+{
+public:
+    explicit FreeUAVs(const vector<UAV> &uavs) : size(1)
+    {
+        while (size < uavs.size())
+            size *= 2;
+        tree.assign(2 * size, -1.0);
+        for (size_t j = 0; j < uavs.size(); j++)
+            tree[size + j] = uavRange(uavs[j]);
+        for (size_t i = size - 1; i > 0; i--)
+            tree[i] = max(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    // Takes and returns the first free UAV with range >= distance, or -1
+    int take(double distance)
+    {
+        if (tree[1] < distance)
+            return -1;
+        size_t i = 1;
+        while (i < size)
+            i = tree[2 * i] >= distance ? 2 * i : 2 * i + 1;
+        int j = i - size;
+        for (tree[i] = -1.0; i > 1; i /= 2)
+            tree[i / 2] = max(tree[i], tree[i ^ 1]);
+        return j;
+    }
+
+private:
+    size_t size;
+    vector<double> tree;
+};
+
+// v7 allocation over candidates already in processing order: each outpost
+// goes to the first unassigned UAV (input order) that can reach it. `served`,
+// if given, receives which candidates got one.
+vector<Allocation> allocateUAVs(const vector<UAV> &uavs, const vector<Candidate> &ordered,
+                                vector<bool> *served = nullptr)
+{
+    vector<Allocation> allocations;
+    FreeUAVs free(uavs);
+    if (served)
+        served->assign(ordered.size(), false);
+    for (size_t i = 0; i < ordered.size() && allocations.size() < uavs.size(); i++)
+    {
+        const Candidate &c = ordered[i];
+        int j = free.take(c.distance);
+        if (j < 0)
+            continue;
+        allocations.push_back({uavs[j].id, c.id, c.distance * uavs[j].energyPerKm});
+        if (served)
+            (*served)[i] = true;
+    }
+    return allocations;
+}
+
+// Bounded heaps, one per class; the top of each is its worst kept candidate
+class TopKStore
+{
+public:
+    TopKStore(const CapabilityClasses &classes, const vector<UAV> &uavs)
+        : classes(classes), uavs(uavs), heaps(classes.range.size() + 1)
+    {
+    }
+
+    // Returns false when no UAV can reach the outpost at all
+    bool offer(const Candidate &c)
+    {
+        int j = classes.classOf(c.distance);
+        if (j == 0)
+            return false;
+        auto &heap = heaps[j];
+        if ((long long)heap.size() < classes.reserve[j])
+        {
+            heap.push(c);
+            kept++;
+        }
+        else if (before(c, heap.top()))
+        {
+            heap.pop();
+            heap.push(c);
+            evicted++;
+        }
+        else
+            evicted++;
+        peak = max(peak, kept);
+        if (kept > PRUNE_FACTOR * (long long)uavs.size())
+            prune();
+        return true;
+    }
+
+    // All kept candidates in v7 processing order
+    vector<Candidate> snapshot() const
+    {
+        vector<Candidate> all;
+        all.reserve(kept);
+        for (auto heap : heaps)
+            while (!heap.empty())
+            {
+                all.push_back(heap.top());
+                heap.pop();
+            }
+        sort(all.begin(), all.end(), before);
+        return all;
+    }
+
+    long long kept = 0, peak = 0, evicted = 0, prunes = 0;
+
+    // Most candidates ever held: Σ N_j, or the prune threshold if lower
+    long long bound() const
+    {
+        long long total = 0;
+        for (size_t j = 1; j < classes.reserve.size(); j++)
+            total += classes.reserve[j];
+        return min(total, PRUNE_FACTOR * (long long)uavs.size() + 1);
+    }
+
+private:
+    struct Worse
+    {
+        bool operator()(const Candidate &a, const Candidate &b) const { return before(a, b); }
+    };
+
+    // Keep only the candidates that v7 serves among those kept
+    void prune()
+    {
+        vector<Candidate> all = snapshot();
+        vector<bool> served;
+        allocateUAVs(uavs, all, &served);
+        for (auto &heap : heaps)
+            heap = {};
+        kept = 0;
+        for (size_t i = 0; i < all.size(); i++)
+            if (served[i])
+            {
+                heaps[classes.classOf(all[i].distance)].push(all[i]);
+                kept++;
+            }
+            else
+                evicted++;
+        prunes++;
+    }
+
+    const CapabilityClasses &classes;
+    const vector<UAV> &uavs;
+    vector<priority_queue<Candidate, vector<Candidate>, Worse>> heaps;
+};
+
+void printAllocations(const vector<Allocation> &allocations, bool quiet)
+{
+    double total = 0;
+    if (!quiet)
+        cout << "\nBest UAV Allocation:\n";
+    for (const auto &allocation : allocations)
+    {
+        if (!quiet)
+            cout << "UAV " << allocation.uavId << " assigned to Outpost " << allocation.outpostId
+                 << " with Energy Cost: " << allocation.energyCost << "\n";
+        total += allocation.energyCost;
+    }
+    cout << "Assigned: " << allocations.size() << " | Total Energy: " << total << "\n";
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --interval=N (print a plan every N outposts)  --batch (keep everything, v7 style)  --quiet
+    long long interval = 0;
+    bool batch = false, quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--interval=", 0) == 0)
+            interval = max(0LL, stoll(arg.substr(11)));
+        else if (arg == "--batch")
+            batch = true;
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    long long numOutposts;
+    int numUAVs;
+    cout << "Enter number of outposts (-1 to read until end of input): ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    auto start = chrono::steady_clock::now();
+    CapabilityClasses classes = buildClasses(uavs);
+    TopKStore store(classes, uavs);
+    vector<Candidate> everything; // --batch only
+    long long streamed = 0, unreachable = 0;
+    Outpost outpost;
+    while ((numOutposts < 0 || streamed < numOutposts) &&
+           cin >> outpost.id >> outpost.medicine >> outpost.food >> outpost.weapons >> outpost.x >> outpost.y >> outpost.priority)
+    {
+        Candidate c{outpost.priority, streamed++, outpost.id,
+                    calculateDistance(baseX, baseY, outpost.x, outpost.y)};
+        if (batch)
+        {
+            everything.push_back(c);
+            continue;
+        }
+        if (!store.offer(c))
+            unreachable++;
+        if (interval > 0 && streamed % interval == 0)
+        {
+            cout << "\n-- After " << streamed << " outposts (" << store.kept << " kept) --\n";
+            printAllocations(allocateUAVs(uavs, store.snapshot()), quiet);
+        }
+    }
+
+    vector<Allocation> allocations;
+    if (batch)
+    {
+        stable_sort(everything.begin(), everything.end(), before);
+        allocations = allocateUAVs(uavs, everything);
+    }
+    else
+        allocations = allocateUAVs(uavs, store.snapshot());
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    printAllocations(allocations, quiet);
+    cout << "Streamed: " << streamed << " outposts | Capability classes: " << classes.range.size();
+    if (batch)
+        cout << " | Kept: " << everything.size() << " (batch)";
+    else
+        cout << " | Kept: " << store.kept << " (peak " << store.peak << ", bound " << store.bound()
+             << ") | Prunes: " << store.prunes << " | Evicted: " << store.evicted
+             << " | Unreachable: " << unreachable;
+    cout << " | Time: " << seconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include "uav_solver.h"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Example client of the solver library: loads the v7 input once, then runs
+// solves in process through either the C++ API or the C ABI
+
+struct Settings
+{
+    uav_options options = uav::defaultOptions();
+    long long deadlineMs = -1; // Cancel after this long (-1: never)
+    long long pollMs = 0;      // Print progress this often (0: never)
+    int repeat = 1;
+    bool cApi = false, quiet = false;
+};
+
+void printPlan(const vector<uav_assignment> &assignments, const uav_summary &summary, bool quiet)
+{
+    if (!quiet)
+    {
+        cout << "\nBest UAV Allocation:\n";
+        for (const auto &a : assignments)
+            cout << "UAV " << a.uav_id << " assigned to Outpost " << a.outpost_id << " with Energy Cost: " << a.energy
+                 << (a.departure > 0 ? " | Departs At: " + to_string(a.departure) : string()) << "\n";
+    }
+    cout << "Assigned: " << summary.assigned << " | Unreachable: " << summary.unreachable
+         << " | Total Energy: " << summary.total_energy << " | Makespan: " << summary.makespan
+         << " | Fitness: " << summary.fitness << " | Improvements: " << summary.version << "\n";
+}
+
+uav_status runCpp(const uav::Instance &instance, const Settings &settings, uav::Plan &plan)
+{
+    uav::Solve solve = uav::solveAsync(instance, settings.options);
+    auto start = chrono::steady_clock::now();
+    uav_status status = UAV_RUNNING;
+    while (status == UAV_RUNNING)
+    {
+        long long waitMs = settings.pollMs > 0 ? settings.pollMs : 3600000;
+        if (settings.deadlineMs >= 0)
+        {
+            long long left = settings.deadlineMs -
+                             chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+            if (left <= 0)
+            {
+                solve.cancel();
+                status = solve.wait();
+                break;
+            }
+            waitMs = min(waitMs, left);
+        }
+        status = solve.waitFor(chrono::milliseconds(waitMs));
+        if (status == UAV_RUNNING && settings.pollMs > 0)
+            cout << "Progress: " << solve.progress() * 100 << "% | best fitness "
+                 << solve.best().summary.fitness << "\n";
+    }
+    plan = solve.best();
+    return status;
+}
+
+uav_status runC(const vector<uav_spec> &uavs, const vector<uav_outpost> &outposts, double baseX, double baseY,
+                const Settings &settings, uav::Plan &plan)
+{
+    uav_solve *solve = nullptr;
+    uav_status status = uav_solve_start(uavs.data(), uavs.size(), outposts.data(), outposts.size(), baseX, baseY,
+                                        &settings.options, &solve);
+    if (status != UAV_OK)
+        return status;
+    if (settings.deadlineMs >= 0)
+    {
+        // The C ABI takes an int; a longer deadline than that is as good as none
+        int timeoutMs = (int)min<long long>(settings.deadlineMs, numeric_limits<int>::max());
+        if (uav_solve_wait(solve, timeoutMs) == UAV_RUNNING)
+            uav_solve_cancel(solve);
+    }
+    status = uav_solve_wait(solve, -1);
+
+    uav_summary summary;
+    uav_solve_best(solve, nullptr, 0, &summary); // Size query
+    plan.assignments.resize(summary.assigned);
+    uav_solve_best(solve, plan.assignments.data(), plan.assignments.size(), &plan.summary);
+    uav_solve_free(solve);
+    return status;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --solver=greedy|schedule|pso|local  --particles=N  --iterations=N  --patience=N  --seed=N
+    //          --deadline=ms  --poll=ms  --repeat=N  --c-api  --quiet
+    Settings settings;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--solver=greedy")
+            settings.options.solver = UAV_SOLVER_GREEDY;
+        else if (arg == "--solver=schedule")
+            settings.options.solver = UAV_SOLVER_SCHEDULE;
+        else if (arg == "--solver=pso")
+            settings.options.solver = UAV_SOLVER_PSO;
+        else if (arg == "--solver=local")
+            settings.options.solver = UAV_SOLVER_LOCAL;
+        else if (arg.rfind("--particles=", 0) == 0)
+            settings.options.particles = stoi(arg.substr(12));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            settings.options.iterations = stoi(arg.substr(13));
+        else if (arg.rfind("--patience=", 0) == 0)
+            settings.options.patience = stoi(arg.substr(11));
+        else if (arg.rfind("--seed=", 0) == 0)
+            settings.options.seed = stoull(arg.substr(7));
+        else if (arg.rfind("--deadline=", 0) == 0)
+            settings.deadlineMs = stoll(arg.substr(11));
+        else if (arg.rfind("--poll=", 0) == 0)
+            settings.pollMs = stoll(arg.substr(7));
+        else if (arg.rfind("--repeat=", 0) == 0)
+            settings.repeat = max(1, stoi(arg.substr(9)));
+        else if (arg == "--c-api")
+            settings.cApi = true;
+        else if (arg == "--quiet")
+            settings.quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<uav_spec> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<uav_outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >>
+            outposts[i].y >> outposts[i].priority;
+    }
+    cout << "\n";
+
+    uav::Instance instance;
+    instance.uavs = uavs;
+    instance.outposts = outposts;
+    instance.baseX = baseX;
+    instance.baseY = baseY;
+
+    uav::Plan plan;
+    uav_status status = UAV_OK;
+    double totalMs = 0;
+    for (int r = 0; r < settings.repeat; r++)
+    {
+        auto start = chrono::steady_clock::now();
+        try
+        {
+            status = settings.cApi ? runC(uavs, outposts, baseX, baseY, settings, plan)
+                                   : runCpp(instance, settings, plan);
+        }
+        catch (const invalid_argument &e)
+        {
+            cerr << "Invalid instance: " << e.what() << "\n";
+            return 1;
+        }
+        totalMs += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (status != UAV_OK && status != UAV_CANCELLED)
+        {
+            cerr << "Solve failed: " << uav_status_string(status) << "\n";
+            return 1;
+        }
+    }
+
+    printPlan(plan.assignments, plan.summary, settings.quiet);
+    cout << "Status: " << uav_status_string(status) << " | Solves: " << settings.repeat
+         << " | Mean latency: " << totalMs / settings.repeat << " ms\n";
+
+    return 0;
+}
@@ -0,0 +1,690 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <atomic>
+#include <new>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+
+const double UNSERVED_PENALTY = 1000.0; // Per priority level left unserved (v23)
+const double MUTATION_RATE = 0.02;
+const int MAX_WORKERS = 255; // Worker index lives in the low 8 bits of the best key
+const size_t ALIGNMENT = 64;
+
+struct UAV
+{
+    int id;
+    double capacity;
+    double energyPerKm;
+    double totalEnergy;
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+size_t alignUp(size_t n)
+{
+    return (n + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+// ---------------------------------------------------------------------------
+// Shared instance. Everything the workers need is derived once by the
+// coordinator and laid out in one POSIX shared memory segment: the fleet,
+// outpost ids and priorities, base distances, and the reach table (outposts
+// each UAV can reach, CSR). The segment is made read-only before any worker
+// starts, so a faulty worker cannot corrupt what the others read.
+// ---------------------------------------------------------------------------
+
+struct InstanceHeader
+{
+    uint32_t numUAVs, numOutposts;
+    uint64_t reachCount;
+    size_t uavsAt, outpostIdAt, priorityAt, distanceAt, reachStartAt, reachAt; // Byte offsets
+    size_t bytes;
+};
+
+struct SharedInstance
+{
+    const InstanceHeader *header;
+    const UAV *uavs;
+    const int *outpostId, *priority;
+    const double *distance;
+    const uint64_t *reachStart; // numUAVs + 1 entries
+    const int *reach;
+
+    explicit SharedInstance(const void *base)
+    {
+        const char *bytes = static_cast<const char *>(base);
+        header = reinterpret_cast<const InstanceHeader *>(bytes);
+        uavs = reinterpret_cast<const UAV *>(bytes + header->uavsAt);
+        outpostId = reinterpret_cast<const int *>(bytes + header->outpostIdAt);
+        priority = reinterpret_cast<const int *>(bytes + header->priorityAt);
+        distance = reinterpret_cast<const double *>(bytes + header->distanceAt);
+        reachStart = reinterpret_cast<const uint64_t *>(bytes + header->reachStartAt);
+        reach = reinterpret_cast<const int *>(bytes + header->reachAt);
+    }
+
+    size_t m() const { return header->numUAVs; }
+    size_t n() const { return header->numOutposts; }
+    double energyCost(int u, int o) const { return distance[o] * uavs[u].energyPerKm; }
+};
+
+// Opens a POSIX shared memory segment, maps it and unlinks the name at once:
+// forked workers inherit the mapping, and nothing is left in /dev/shm if the
+// coordinator dies
+void *createSegment(const string &name, size_t bytes)
+{
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+        return nullptr;
+    void *base = MAP_FAILED;
+    if (ftruncate(fd, bytes) == 0)
+        base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    shm_unlink(name.c_str());
+    return base == MAP_FAILED ? nullptr : base;
+}
+
+void *buildInstance(const string &name, const vector<UAV> &uavs, const vector<Outpost> &outposts, double baseX,
+                    double baseY)
+{
+    size_t m = uavs.size(), n = outposts.size();
+    vector<double> distance(n);
+    for (size_t o = 0; o < n; o++)
+        distance[o] = calculateDistance(baseX, baseY, outposts[o].x, outposts[o].y);
+    vector<uint64_t> reachStart(m + 1, 0);
+    for (size_t u = 0; u < m; u++)
+    {
+        reachStart[u + 1] = reachStart[u];
+        for (size_t o = 0; o < n; o++)
+            if (distance[o] * uavs[u].energyPerKm <= uavs[u].totalEnergy)
+                reachStart[u + 1]++;
+    }
+
+    InstanceHeader header;
+    header.numUAVs = m;
+    header.numOutposts = n;
+    header.reachCount = reachStart[m];
+    header.uavsAt = alignUp(sizeof(InstanceHeader));
+    header.outpostIdAt = alignUp(header.uavsAt + m * sizeof(UAV));
+    header.priorityAt = alignUp(header.outpostIdAt + n * sizeof(int));
+    header.distanceAt = alignUp(header.priorityAt + n * sizeof(int));
+    header.reachStartAt = alignUp(header.distanceAt + n * sizeof(double));
+    header.reachAt = alignUp(header.reachStartAt + (m + 1) * sizeof(uint64_t));
+    header.bytes = alignUp(header.reachAt + header.reachCount * sizeof(int));
+
+    char *base = static_cast<char *>(createSegment(name, header.bytes));
+    if (!base)
+        return nullptr;
+    memcpy(base, &header, sizeof(header));
+    memcpy(base + header.uavsAt, uavs.data(), m * sizeof(UAV));
+    int *outpostId = reinterpret_cast<int *>(base + header.outpostIdAt);
+    int *priority = reinterpret_cast<int *>(base + header.priorityAt);
+    for (size_t o = 0; o < n; o++)
+    {
+        outpostId[o] = outposts[o].id;
+        priority[o] = outposts[o].priority;
+    }
+    memcpy(base + header.distanceAt, distance.data(), n * sizeof(double));
+    memcpy(base + header.reachStartAt, reachStart.data(), (m + 1) * sizeof(uint64_t));
+    int *reach = reinterpret_cast<int *>(base + header.reachAt);
+    for (size_t u = 0; u < m; u++)
+        for (size_t o = 0; o < n; o++)
+            if (distance[o] * uavs[u].energyPerKm <= uavs[u].totalEnergy)
+                *reach++ = o;
+
+    if (mprotect(base, header.bytes, PROT_READ) != 0)
+        return nullptr;
+    return base;
+}
+
+// ---------------------------------------------------------------------------
+// Control segment: the only memory workers write. Each worker owns one slot
+// holding its best plan in two buffers, each behind its own sequence number
+// (single writer, so writers never wait). The writer fills the buffer not
+// currently published and then flips `current`, so the published buffer is
+// always complete: a worker that dies mid-write leaves a half-written spare,
+// never a half-written plan a reader could wait on forever. The global best
+// is one 64-bit key: the fitness bits (positive doubles order like their bit
+// patterns) with the low 8 bits replaced by the owning worker. Publishing is a
+// CAS-min on that key after the slot is written, so readers follow the key to
+// a slot and read its published buffer.
+// ---------------------------------------------------------------------------
+
+enum WorkerState : int
+{
+    STARTING = 0,
+    RUNNING,
+    FINISHED
+};
+
+double bitsToDouble(uint64_t bits)
+{
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+struct alignas(64) WorkerSlot
+{
+    atomic<uint32_t> current; // Published buffer
+    atomic<uint32_t> seq[2];  // Per buffer: odd while being written, 0 if never written
+    atomic<uint64_t> fitnessBits[2];
+    atomic<int> state;
+    atomic<int> iterations;
+    atomic<uint64_t> privateKB; // Memory this worker does not share
+
+    double bestFitness() const { return bitsToDouble(fitnessBits[current.load(memory_order_acquire)]); }
+};
+
+struct ControlHeader
+{
+    atomic<uint64_t> bestKey;
+    atomic<int> stop;
+    int numWorkers;
+    uint32_t numUAVs;
+    size_t slotsAt, plansAt; // Byte offsets; buffer b of worker w is numUAVs ints at plansAt + (2w + b) * numUAVs
+};
+
+static_assert(atomic<uint64_t>::is_always_lock_free && atomic<int32_t>::is_always_lock_free,
+              "shared memory atomics must be lock-free");
+
+const uint64_t NO_BEST = numeric_limits<uint64_t>::max();
+
+uint64_t makeKey(double fitness, int worker)
+{
+    uint64_t bits;
+    memcpy(&bits, &fitness, sizeof(bits));
+    return (bits & ~0xFFULL) | (uint64_t)worker;
+}
+
+class Control
+{
+public:
+    explicit Control(void *base) : header(static_cast<ControlHeader *>(base))
+    {
+        char *bytes = static_cast<char *>(base);
+        slots = reinterpret_cast<WorkerSlot *>(bytes + header->slotsAt);
+        plans = reinterpret_cast<atomic<int32_t> *>(bytes + header->plansAt);
+    }
+
+    static size_t bytesFor(int workers, size_t m)
+    {
+        return alignUp(alignUp(alignUp(sizeof(ControlHeader)) + workers * sizeof(WorkerSlot)) +
+                       2 * workers * m * sizeof(int32_t));
+    }
+
+    static void initialise(void *base, int workers, size_t m)
+    {
+        auto *header = new (base) ControlHeader;
+        header->bestKey = NO_BEST;
+        header->stop = 0;
+        header->numWorkers = workers;
+        header->numUAVs = m;
+        header->slotsAt = alignUp(sizeof(ControlHeader));
+        header->plansAt = alignUp(header->slotsAt + workers * sizeof(WorkerSlot));
+        char *bytes = static_cast<char *>(base);
+        for (int w = 0; w < workers; w++)
+        {
+            auto *slot = new (bytes + header->slotsAt + w * sizeof(WorkerSlot)) WorkerSlot;
+            slot->current = 0;
+            for (int b = 0; b < 2; b++)
+            {
+                slot->seq[b] = 0;
+                slot->fitnessBits[b] = 0;
+            }
+            slot->state = STARTING;
+            slot->iterations = 0;
+            slot->privateKB = 0;
+        }
+        auto *plans = reinterpret_cast<atomic<int32_t> *>(bytes + header->plansAt);
+        for (size_t i = 0; i < 2 * workers * m; i++)
+            new (&plans[i]) atomic<int32_t>(-1);
+    }
+
+    WorkerSlot &slot(int w) { return slots[w]; }
+    bool stopRequested() const { return header->stop.load(memory_order_relaxed) != 0; }
+    void requestStop() { header->stop = 1; }
+    uint64_t bestKey() const { return header->bestKey.load(memory_order_acquire); }
+
+    // Worker side: fill the spare buffer, publish it, then CAS-min the key
+    void publish(int w, const vector<int> &plan, double fitness)
+    {
+        WorkerSlot &s = slots[w];
+        uint32_t b = 1 - s.current.load(memory_order_relaxed);
+        uint32_t seq = s.seq[b].load(memory_order_relaxed);
+        s.seq[b].store(seq + 1, memory_order_relaxed); // Odd: write in progress
+        atomic_thread_fence(memory_order_release);
+        atomic<int32_t> *out = buffer(w, b);
+        for (size_t u = 0; u < plan.size(); u++)
+            out[u].store(plan[u], memory_order_relaxed);
+        uint64_t bits;
+        memcpy(&bits, &fitness, sizeof(bits));
+        s.fitnessBits[b].store(bits, memory_order_relaxed);
+        s.seq[b].store(seq + 2, memory_order_release);
+        s.current.store(b, memory_order_release);
+
+        uint64_t key = makeKey(fitness, w), current = header->bestKey.load(memory_order_relaxed);
+        while (key < current && !header->bestKey.compare_exchange_weak(current, key, memory_order_acq_rel))
+        {
+        }
+    }
+
+    // Any side: consistent copy of a worker's best plan. False if it has none.
+    // A retry only happens when the writer has flipped `current` since it was
+    // read, so a writer that died, even mid-write, cannot keep a reader here.
+    bool read(int w, vector<int> &plan, double &fitness) const
+    {
+        const WorkerSlot &s = slots[w];
+        plan.resize(header->numUAVs);
+        while (true)
+        {
+            uint32_t b = s.current.load(memory_order_acquire);
+            uint32_t before = s.seq[b].load(memory_order_acquire);
+            if (before == 0)
+                return false;
+            if (before & 1)
+            {
+                this_thread::yield();
+                continue;
+            }
+            const atomic<int32_t> *in = buffer(w, b);
+            for (size_t u = 0; u < plan.size(); u++)
+                plan[u] = in[u].load(memory_order_relaxed);
+            fitness = bitsToDouble(s.fitnessBits[b].load(memory_order_relaxed));
+            atomic_thread_fence(memory_order_acquire);
+            if (s.seq[b].load(memory_order_relaxed) == before)
+                return true;
+        }
+    }
+
+    // Best plan of all workers; its fitness is never worse than the key says
+    bool readBest(vector<int> &plan, double &fitness, int &worker) const
+    {
+        uint64_t key = bestKey();
+        if (key == NO_BEST)
+            return false;
+        worker = key & 0xFF;
+        return read(worker, plan, fitness);
+    }
+
+private:
+    atomic<int32_t> *buffer(int w, uint32_t b) const { return plans + (2 * (size_t)w + b) * header->numUAVs; }
+
+    ControlHeader *header;
+    WorkerSlot *slots;
+    atomic<int32_t> *plans;
+};
+
+// ---------------------------------------------------------------------------
+// Worker: one PSO island (v23 update rule) against the shared instance. Every
+// `migrate` iterations it adopts the global best if another island has found
+// something better, replacing its worst particle.
+// ---------------------------------------------------------------------------
+
+struct WorkerConfig
+{
+    int particles, iterations, patience, migrate;
+    uint64_t seed;
+    int fault; // Worker that aborts part way (fault containment demo), -1 for none
+};
+
+double evaluate(const SharedInstance &in, const vector<int> &assignment, vector<char> &served)
+{
+    double total = 0.0;
+    fill(served.begin(), served.end(), 0);
+    for (size_t u = 0; u < assignment.size(); u++)
+        if (assignment[u] >= 0)
+        {
+            total += in.energyCost(u, assignment[u]);
+            served[assignment[u]] = 1;
+        }
+    for (size_t o = 0; o < in.n(); o++)
+        if (!served[o])
+            total += UNSERVED_PENALTY * in.priority[o];
+    return total;
+}
+
+// Drop second visits to the same outpost (genes only ever come from reach lists)
+void repair(vector<int> &assignment, vector<char> &taken)
+{
+    fill(taken.begin(), taken.end(), 0);
+    for (size_t u = 0; u < assignment.size(); u++)
+    {
+        int o = assignment[u];
+        if (o < 0)
+            continue;
+        if (taken[o])
+            assignment[u] = -1;
+        else
+            taken[o] = 1;
+    }
+}
+
+// v7 allocation: highest priority first, each to the first idle UAV that reaches it
+vector<int> greedyPlan(const SharedInstance &in)
+{
+    vector<int> order(in.n());
+    for (size_t o = 0; o < order.size(); o++)
+        order[o] = o;
+    stable_sort(order.begin(), order.end(), [&](int a, int b) { return in.priority[a] > in.priority[b]; });
+    vector<int> assignment(in.m(), -1);
+    size_t idle = in.m();
+    for (size_t k = 0; k < order.size() && idle > 0; k++)
+        for (size_t u = 0; u < in.m(); u++)
+            if (assignment[u] < 0 && in.energyCost(u, order[k]) <= in.uavs[u].totalEnergy)
+            {
+                assignment[u] = order[k];
+                idle--;
+                break;
+            }
+    return assignment;
+}
+
+uint64_t privateMemoryKB()
+{
+    ifstream file("/proc/self/smaps_rollup");
+    string line;
+    uint64_t total = 0;
+    while (getline(file, line))
+        if (line.rfind("Private_Clean:", 0) == 0 || line.rfind("Private_Dirty:", 0) == 0)
+            total += stoull(line.substr(line.find(':') + 1));
+    return total;
+}
+
+struct Particle
+{
+    vector<int> position, best;
+    double fitness, bestFitness;
+};
+
+void runWorker(int w, const SharedInstance &in, Control &control, const WorkerConfig &config)
+{
+    WorkerSlot &slot = control.slot(w);
+    slot.state = RUNNING;
+    size_t m = in.m();
+    mt19937 rng(config.seed + w);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<char> scratch(in.n());
+    auto randomGene = [&](size_t u) {
+        uint64_t begin = in.reachStart[u], count = in.reachStart[u + 1] - begin;
+        uniform_int_distribution<uint64_t> pick(0, count); // count means idle
+        uint64_t k = pick(rng);
+        return k < count ? in.reach[begin + k] : -1;
+    };
+
+    vector<Particle> swarm(config.particles);
+    vector<int> best;
+    double bestFitness = numeric_limits<double>::max();
+    for (size_t p = 0; p < swarm.size(); p++)
+    {
+        auto &particle = swarm[p];
+        if (p == 0)
+            particle.position = greedyPlan(in); // Every island starts from the v7 plan
+        else
+        {
+            particle.position.resize(m);
+            for (size_t u = 0; u < m; u++)
+                particle.position[u] = randomGene(u);
+            repair(particle.position, scratch);
+        }
+        particle.fitness = particle.bestFitness = evaluate(in, particle.position, scratch);
+        particle.best = particle.position;
+        if (particle.fitness < bestFitness)
+        {
+            bestFitness = particle.fitness;
+            best = particle.position;
+        }
+    }
+    control.publish(w, best, bestFitness);
+
+    vector<int> migrant;
+    int lastImprovement = 0;
+    for (int iter = 1; iter <= config.iterations && iter - lastImprovement <= config.patience; iter++)
+    {
+        if (control.stopRequested())
+            break;
+        if (w == config.fault && iter == config.iterations / 2)
+            abort();
+
+        for (auto &particle : swarm)
+        {
+            for (size_t u = 0; u < m; u++)
+            {
+                if (unit(rng) < MUTATION_RATE)
+                    particle.position[u] = randomGene(u);
+                else
+                    particle.position[u] = (rng() & 1) ? particle.best[u] : best[u];
+            }
+            repair(particle.position, scratch);
+            particle.fitness = evaluate(in, particle.position, scratch);
+            if (particle.fitness < particle.bestFitness)
+            {
+                particle.bestFitness = particle.fitness;
+                particle.best = particle.position;
+            }
+            if (particle.fitness < bestFitness)
+            {
+                bestFitness = particle.fitness;
+                best = particle.position;
+                lastImprovement = iter;
+            }
+        }
+        if (lastImprovement == iter)
+            control.publish(w, best, bestFitness);
+
+        double migrantFitness;
+        int from;
+        if (config.migrate > 0 && iter % config.migrate == 0 && control.readBest(migrant, migrantFitness, from) &&
+            from != w && migrantFitness < bestFitness)
+        {
+            auto worst = max_element(swarm.begin(), swarm.end(), [](const Particle &a, const Particle &b) {
+                return a.bestFitness < b.bestFitness;
+            });
+            worst->position = worst->best = best = migrant;
+            worst->fitness = worst->bestFitness = bestFitness = migrantFitness;
+            lastImprovement = iter;
+        }
+        slot.iterations.store(iter, memory_order_relaxed);
+    }
+    slot.privateKB = privateMemoryKB();
+    slot.state = FINISHED;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --workers=N  --particles=N  --iterations=N  --patience=N  --migrate=N  --seed=N
+    //          --deadline=ms  --fault=W (worker W aborts half way)  --quiet
+    int numWorkers = 4, particles = 50, iterations = 100, patience = 100, migrate = 10, fault = -1;
+    long long deadlineMs = -1;
+    uint64_t seed = 42;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--workers=", 0) == 0)
+            numWorkers = min(MAX_WORKERS, max(1, stoi(arg.substr(10))));
+        else if (arg.rfind("--particles=", 0) == 0)
+            particles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            iterations = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--patience=", 0) == 0)
+            patience = max(0, stoi(arg.substr(11)));
+        else if (arg.rfind("--migrate=", 0) == 0)
+            migrate = max(0, stoi(arg.substr(10)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoull(arg.substr(7));
+        else if (arg.rfind("--deadline=", 0) == 0)
+            deadlineMs = stoll(arg.substr(11));
+        else if (arg.rfind("--fault=", 0) == 0)
+            fault = stoi(arg.substr(8));
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >>
+            outposts[i].y >> outposts[i].priority;
+    }
+    cout << "\n";
+
+    auto start = chrono::steady_clock::now();
+    string prefix = "/uav_v30_" + to_string(getpid());
+    void *instanceBase = buildInstance(prefix + "_instance", uavs, outposts, baseX, baseY);
+    size_t controlBytes = Control::bytesFor(numWorkers, numUAVs);
+    void *controlBase = createSegment(prefix + "_control", controlBytes);
+    if (!instanceBase || !controlBase)
+    {
+        cerr << "Cannot create shared memory: " << strerror(errno) << "\n";
+        return 1;
+    }
+    Control::initialise(controlBase, numWorkers, numUAVs);
+    SharedInstance in(instanceBase);
+    Control control(controlBase);
+    // The coordinator's parsed copy is not needed by anyone from here on
+    vector<UAV>().swap(uavs);
+    vector<Outpost>().swap(outposts);
+
+    WorkerConfig config{particles, iterations, patience, migrate, seed, fault};
+    vector<pid_t> pids(numWorkers);
+    cout.flush();
+    for (int w = 0; w < numWorkers; w++)
+    {
+        pids[w] = fork();
+        if (pids[w] < 0)
+        {
+            cerr << "fork failed: " << strerror(errno) << "\n";
+            control.requestStop();
+            pids.resize(w);
+            break;
+        }
+        if (pids[w] == 0)
+        {
+            runWorker(w, in, control, config);
+            _exit(0);
+        }
+    }
+
+    // Wait for the workers; a crash costs only that island
+    size_t running = pids.size();
+    vector<int> exitStatus(pids.size(), 0);
+    while (running > 0)
+    {
+        if (deadlineMs >= 0 && chrono::steady_clock::now() - start > chrono::milliseconds(deadlineMs))
+            control.requestStop();
+        int status;
+        pid_t pid = waitpid(-1, &status, WNOHANG);
+        if (pid > 0)
+        {
+            for (size_t w = 0; w < pids.size(); w++)
+                if (pids[w] == pid)
+                    exitStatus[w] = status;
+            running--;
+        }
+        else
+            this_thread::sleep_for(chrono::milliseconds(5));
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<int> plan;
+    double fitness = 0;
+    int bestWorker = -1;
+    if (!control.readBest(plan, fitness, bestWorker))
+    {
+        cerr << "No worker produced a plan\n";
+        return 1;
+    }
+
+    if (!quiet)
+        cout << "Best UAV Allocation:\n";
+    int served = 0;
+    double totalEnergy = 0;
+    for (size_t u = 0; u < plan.size(); u++)
+    {
+        if (plan[u] < 0)
+            continue;
+        double energy = in.energyCost(u, plan[u]);
+        if (!quiet)
+            cout << "UAV " << in.uavs[u].id << " assigned to Outpost " << in.outpostId[plan[u]]
+                 << " with Energy Cost: " << energy << "\n";
+        served++;
+        totalEnergy += energy;
+    }
+
+    cout << "\nWorkers:\n";
+    uint64_t privateTotal = 0;
+    for (size_t w = 0; w < pids.size(); w++)
+    {
+        WorkerSlot &slot = control.slot(w);
+        cout << "  worker " << w << ": ";
+        if (WIFSIGNALED(exitStatus[w]))
+            cout << "killed by signal " << WTERMSIG(exitStatus[w]) << " after " << slot.iterations << " iterations";
+        else
+        {
+            cout << slot.iterations << " iterations, best " << slot.bestFitness() << ", private "
+                 << slot.privateKB << " KB";
+            privateTotal += slot.privateKB;
+        }
+        cout << ((int)w == bestWorker ? "  <- best\n" : "\n");
+    }
+    cout << "Served " << served << "/" << in.n() << " outposts, total energy " << totalEnergy << ", fitness "
+         << fitness << "\n";
+    cout << "Shared instance: " << in.header->bytes / 1024 << " KB (" << in.header->reachCount
+         << " reach entries) | Control: " << controlBytes / 1024 << " KB | Worker private total: " << privateTotal
+         << " KB | Time: " << seconds << " s\n";
+
+    return 0;
+}
@@ -0,0 +1,651 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+#include <unordered_set>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Microbenchmarks for the hot kernels of v1-v8. Each kernel is copied as it
+// stands in its version so the numbers describe that code, not a rewrite.
+
+const double ALPHA = 0.5; // v6 priority weights
+const double BETA = 0.3;
+const double GAMMA = 0.2;
+
+struct UAV
+{
+    int id;
+    double weight_capacity;
+    double energy_per_km;
+    double total_energy;
+};
+
+struct Outpost // v1-v5, v7, v8: priority is the 1-5 level
+{
+    int id;
+    double medicine, food, weapons;
+    double x, y;
+    int priority;
+};
+
+struct WeightedOutpost // v6: priority is the calculatePriority score
+{
+    int id;
+    double medicine, food, weapons;
+    double x, y;
+    double priority;
+};
+
+struct BaseStation
+{
+    double x, y;
+};
+
+// ---------------------------------------------------------------------------
+// Kernels
+// ---------------------------------------------------------------------------
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+double calculatePriority(const WeightedOutpost &outpost, const BaseStation &base) // v6
+{
+    double resource_urgency = outpost.medicine + outpost.food + outpost.weapons;
+    double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+    double distance_factor = (distance > 0) ? (1.0 / distance) : 1.0;
+    return ALPHA * resource_urgency + BETA * distance_factor + GAMMA * outpost.priority;
+}
+
+double fitnessV1(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy = 0;
+    double priority_score = 0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        if (outpost_id == -1)
+            continue;
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+        total_energy += energy_used;
+        priority_score += outpost.priority;
+    }
+    return total_energy - (priority_score * 10);
+}
+
+double fitnessV2(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy = 0;
+    double priority_score = 0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        if (outpost_id == -1)
+            continue;
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+        total_energy += energy_used;
+        priority_score += outpost.priority;
+    }
+    return (total_energy == 0) ? numeric_limits<double>::max() : total_energy - (priority_score * 10);
+}
+
+double fitnessV3(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy = 0;
+    double penalty = 0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        if (outpost_id == -1)
+            continue;
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+        total_energy += energy_used;
+        penalty += (100 / (outpost.priority + 1));
+    }
+    return total_energy + penalty;
+}
+
+double fitnessV4(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy = 0;
+    vector<bool> assigned(outposts.size(), false);
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        if (outpost_id == -1 || assigned[outpost_id])
+            continue;
+        assigned[outpost_id] = true;
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+        total_energy += energy_used;
+        total_energy += (100 / (outpost.priority + 1));
+    }
+    return total_energy;
+}
+
+double fitnessV5(const vector<int> &assignment, const vector<UAV> &uavs, const vector<Outpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy = 0;
+    unordered_set<int> assignedOutposts;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        if (outpost_id == -1)
+            continue;
+        const UAV &uav = uavs[i];
+        const Outpost &outpost = outposts[outpost_id];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_used = 2 * distance * uav.energy_per_km;
+        if (energy_used > uav.total_energy)
+            return numeric_limits<double>::max();
+        total_energy += energy_used;
+        total_energy += (100 / (outpost.priority + 1));
+        if (assignedOutposts.count(outpost_id))
+            total_energy += 1000;
+        assignedOutposts.insert(outpost_id);
+    }
+    return total_energy;
+}
+
+double fitnessV6(const vector<int> &assignment, const vector<UAV> &uavs, const vector<WeightedOutpost> &outposts,
+                 const BaseStation &base)
+{
+    double total_energy_cost = 0.0;
+    for (size_t i = 0; i < assignment.size(); i++)
+    {
+        int outpost_id = assignment[i];
+        const WeightedOutpost &outpost = outposts[outpost_id];
+        const UAV &uav = uavs[i];
+        double distance = calculateDistance(base.x, base.y, outpost.x, outpost.y);
+        double energy_required = distance * uav.energy_per_km;
+        if (energy_required > uav.total_energy || outpost.priority == 0)
+            return numeric_limits<double>::max();
+        total_energy_cost += energy_required / outpost.priority;
+    }
+    return total_energy_cost;
+}
+
+// v5: distinct random outposts per particle by rejection sampling
+void initializeParticlesV5(vector<vector<int>> &particles, int numParticles, int numUAVs, int numOutposts)
+{
+    for (int i = 0; i < numParticles; i++)
+    {
+        vector<int> assignment(numUAVs);
+        unordered_set<int> usedOutposts;
+        for (int j = 0; j < numUAVs; j++)
+        {
+            int outpost;
+            do
+            {
+                outpost = rand() % numOutposts;
+            } while (usedOutposts.count(outpost));
+            usedOutposts.insert(outpost);
+            assignment[j] = outpost;
+        }
+        particles[i] = assignment;
+    }
+}
+
+// v7 allocateUAVs after its sort: the outpost x UAV scan
+size_t allocateV7(const vector<UAV> &uavs, const vector<Outpost> &outposts, const BaseStation &base)
+{
+    size_t allocations = 0;
+    vector<bool> assignedOutposts(outposts.size(), false);
+    vector<bool> assignedUAVs(uavs.size(), false);
+    for (size_t i = 0; i < outposts.size(); i++)
+    {
+        for (size_t j = 0; j < uavs.size(); j++)
+        {
+            if (!assignedUAVs[j] && !assignedOutposts[i])
+            {
+                double distance = calculateDistance(base.x, base.y, outposts[i].x, outposts[i].y);
+                double energyCost = distance * uavs[j].energy_per_km;
+                if (energyCost <= uavs[j].total_energy)
+                {
+                    allocations++;
+                    assignedUAVs[j] = true;
+                    assignedOutposts[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+    return allocations;
+}
+
+struct Task // v8
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Counters. One perf_event_open group per run (cycles, instructions, cache
+// misses, branch misses, user space only). Events the kernel or the machine
+// refuses are left out; with none at all, only the wall clock is reported.
+// ---------------------------------------------------------------------------
+
+enum Counter
+{
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    NUM_COUNTERS
+};
+
+const char *const COUNTER_NAMES[NUM_COUNTERS] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+const uint64_t COUNTER_CONFIG[NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                               PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+class PerfCounters
+{
+public:
+    explicit PerfCounters(bool enable)
+    {
+        if (!enable)
+            error = "disabled";
+        for (int c = 0; c < NUM_COUNTERS && enable; c++)
+        {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = COUNTER_CONFIG[c];
+            attr.disabled = leader < 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            int fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fd < 0)
+            {
+                if (c == 0)
+                    error = strerror(errno);
+                continue;
+            }
+            if (leader < 0)
+                leader = fd;
+            fds.push_back(fd);
+            slot[c] = fds.size() - 1;
+        }
+    }
+
+    ~PerfCounters()
+    {
+        for (int fd : fds)
+            close(fd);
+    }
+
+    bool available() const { return leader >= 0; }
+    bool has(int c) const { return slot[c] >= 0; }
+    const string &why() const { return error; }
+
+    void start()
+    {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    // Counts since start(), scaled up if the group was multiplexed
+    void stop(double counts[NUM_COUNTERS])
+    {
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t data[3 + NUM_COUNTERS] = {0};
+        if (read(leader, data, sizeof(data)) < 0)
+            return;
+        double scale = data[2] > 0 ? (double)data[1] / data[2] : 1.0;
+        for (int c = 0; c < NUM_COUNTERS; c++)
+            counts[c] = has(c) ? data[3 + slot[c]] * scale : NAN;
+    }
+
+private:
+    int leader = -1;
+    vector<int> fds;
+    int slot[NUM_COUNTERS] = {-1, -1, -1, -1};
+    string error = "not attempted";
+};
+
+// ---------------------------------------------------------------------------
+// Harness
+// ---------------------------------------------------------------------------
+
+volatile double sink; // Results land here so the optimiser cannot drop a kernel
+
+struct Benchmark
+{
+    string name;
+    string unit; // What one operation is
+    function<void(long long)> run; // Runs the kernel this many times
+};
+
+struct Result
+{
+    string name, unit;
+    long long ops;
+    double nsPerOp;
+    double perOp[NUM_COUNTERS];
+};
+
+Result measure(const Benchmark &bench, PerfCounters &perf, int samples, double minSeconds)
+{
+    // Calibrate: double the batch until it takes long enough to time reliably
+    long long batch = 1;
+    while (true)
+    {
+        auto start = chrono::steady_clock::now();
+        bench.run(batch);
+        if (chrono::duration<double>(chrono::steady_clock::now() - start).count() >= minSeconds || batch >= (1LL << 40))
+            break;
+        batch *= 2;
+    }
+
+    // Median sample by time; its counters go with it
+    vector<Result> runs;
+    for (int s = 0; s < samples; s++)
+    {
+        Result r{bench.name, bench.unit, batch, 0, {NAN, NAN, NAN, NAN}};
+        if (perf.available())
+            perf.start();
+        auto start = chrono::steady_clock::now();
+        bench.run(batch);
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        double counts[NUM_COUNTERS] = {NAN, NAN, NAN, NAN};
+        if (perf.available())
+            perf.stop(counts);
+        r.nsPerOp = ns / batch;
+        for (int c = 0; c < NUM_COUNTERS; c++)
+            r.perOp[c] = counts[c] / batch;
+        runs.push_back(r);
+    }
+    sort(runs.begin(), runs.end(), [](const Result &a, const Result &b) { return a.nsPerOp < b.nsPerOp; });
+    return runs[runs.size() / 2];
+}
+
+vector<Benchmark> makeBenchmarks(int numUAVs, int numOutposts, int numParticles, uint64_t seed)
+{
+    // One instance shared by every kernel. Energy is generous so no fitness
+    // variant bails out early on an infeasible UAV.
+    auto uavs = make_shared<vector<UAV>>(numUAVs);
+    auto outposts = make_shared<vector<Outpost>>(numOutposts);
+    auto weighted = make_shared<vector<WeightedOutpost>>(numOutposts);
+    auto base = make_shared<BaseStation>(BaseStation{0, 0});
+    mt19937 rng(seed);
+    uniform_real_distribution<double> coord(-100, 100), resource(0, 10), epk(1, 4);
+    uniform_int_distribution<int> level(1, 5);
+    for (int i = 0; i < numUAVs; i++)
+        (*uavs)[i] = {i + 1, 50, epk(rng), 1e6};
+    for (int i = 0; i < numOutposts; i++)
+    {
+        Outpost o{i + 1, resource(rng), resource(rng), resource(rng), coord(rng), coord(rng), level(rng)};
+        (*outposts)[i] = o;
+        WeightedOutpost w{o.id, o.medicine, o.food, o.weapons, o.x, o.y, (double)o.priority};
+        w.priority = calculatePriority(w, *base);
+        (*weighted)[i] = w;
+    }
+    auto sorted = make_shared<vector<Outpost>>(*outposts); // v7 input: already sorted by priority
+    sort(sorted->begin(), sorted->end(), [](const Outpost &a, const Outpost &b) { return a.priority > b.priority; });
+
+    auto assignment = make_shared<vector<int>>(numUAVs);
+    uniform_int_distribution<int> pick(0, numOutposts - 1);
+    for (auto &o : *assignment)
+        o = pick(rng);
+
+    string perEval = "evaluation (" + to_string(numUAVs) + " UAVs)";
+    vector<Benchmark> benches;
+    benches.push_back({"calculateDistance", "call", [=](long long n) {
+                           double total = 0;
+                           for (long long k = 0; k < n; k++)
+                           {
+                               const Outpost &o = (*outposts)[k % numOutposts];
+                               total += calculateDistance(base->x, base->y, o.x, o.y);
+                           }
+                           sink = total;
+                       }});
+    benches.push_back({"calculatePriority_v6", "call", [=](long long n) {
+                           double total = 0;
+                           for (long long k = 0; k < n; k++)
+                               total += calculatePriority((*weighted)[k % numOutposts], *base);
+                           sink = total;
+                       }});
+
+    typedef double (*Fitness)(const vector<int> &, const vector<UAV> &, const vector<Outpost> &,
+                              const BaseStation &);
+    const pair<const char *, Fitness> variants[] = {{"fitness_v1", fitnessV1}, {"fitness_v2", fitnessV2},
+                                                    {"fitness_v3", fitnessV3}, {"fitness_v4", fitnessV4},
+                                                    {"fitness_v5", fitnessV5}};
+    for (const auto &variant : variants)
+    {
+        Fitness f = variant.second;
+        benches.push_back({variant.first, perEval, [=](long long n) {
+                               double total = 0;
+                               for (long long k = 0; k < n; k++)
+                                   total += f(*assignment, *uavs, *outposts, *base);
+                               sink = total;
+                           }});
+    }
+    benches.push_back({"fitness_v6", perEval, [=](long long n) {
+                           double total = 0;
+                           for (long long k = 0; k < n; k++)
+                               total += fitnessV6(*assignment, *uavs, *weighted, *base);
+                           sink = total;
+                       }});
+
+    benches.push_back({"initializeParticles_v5", "swarm (" + to_string(numParticles) + " particles)",
+                       [=](long long n) {
+                           vector<vector<int>> particles(numParticles);
+                           srand(seed);
+                           for (long long k = 0; k < n; k++)
+                               initializeParticlesV5(particles, numParticles, numUAVs, numOutposts);
+                           sink = particles[0][0];
+                       }});
+    benches.push_back({"allocateUAVs_v7", "allocation (" + to_string(numOutposts) + " outposts)",
+                       [=](long long n) {
+                           size_t total = 0;
+                           for (long long k = 0; k < n; k++)
+                               total += allocateV7(*uavs, *sorted, *base);
+                           sink = total;
+                       }});
+    benches.push_back({"heap_cycle_v8", "pop + push (" + to_string(numUAVs) + " UAVs)", [=](long long n) {
+                           priority_queue<Task, vector<Task>, greater<Task>> pq;
+                           for (int i = 0; i < numUAVs; i++)
+                               pq.push({0, i});
+                           for (long long k = 0; k < n; k++)
+                           {
+                               Task task = pq.top();
+                               pq.pop();
+                               double distance = calculateDistance(base->x, base->y, (*outposts)[k % numOutposts].x,
+                                                                   (*outposts)[k % numOutposts].y);
+                               pq.push({task.time + 2 * (distance / 10.0), task.uavIndex});
+                           }
+                           sink = pq.top().time;
+                       }});
+    return benches;
+}
+
+// ---------------------------------------------------------------------------
+// Output
+// ---------------------------------------------------------------------------
+
+string number(double value)
+{
+    if (std::isnan(value))
+        return "null";
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.6g", value);
+    return buffer;
+}
+
+double ipc(const Result &r)
+{
+    return r.perOp[INSTRUCTIONS] / r.perOp[CYCLES];
+}
+
+void writeText(ostream &out, const vector<Result> &results, const string &source)
+{
+    out << "Counters: " << source << "\n\n";
+    out << "kernel                     ns/op      cycles/op  instr/op   IPC    cache-miss/op  branch-miss/op  unit\n";
+    for (const auto &r : results)
+    {
+        char line[256];
+        snprintf(line, sizeof(line), "%-24s %10.2f  %10s %10s %6s %14s %15s  ", r.name.c_str(), r.nsPerOp,
+                 number(r.perOp[CYCLES]).c_str(), number(r.perOp[INSTRUCTIONS]).c_str(), number(ipc(r)).c_str(),
+                 number(r.perOp[CACHE_MISSES]).c_str(), number(r.perOp[BRANCH_MISSES]).c_str());
+        out << line << r.unit << "\n";
+    }
+}
+
+void writeJson(ostream &out, const vector<Result> &results, const string &source, int numUAVs, int numOutposts)
+{
+    out << "{\"version\":1,\"counters\":\"" << source << "\",\"uavs\":" << numUAVs << ",\"outposts\":" << numOutposts
+        << ",\"benchmarks\":[";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const auto &r = results[i];
+        out << (i ? "," : "") << "\n{\"name\":\"" << r.name << "\",\"unit\":\"" << r.unit << "\",\"ops\":" << r.ops
+            << ",\"ns_per_op\":" << number(r.nsPerOp);
+        for (int c = 0; c < NUM_COUNTERS; c++)
+            out << ",\"" << COUNTER_NAMES[c] << "_per_op\":" << number(r.perOp[c]);
+        out << ",\"ipc\":" << number(ipc(r)) << "}";
+    }
+    out << "\n]}\n";
+}
+
+void writeCsv(ostream &out, const vector<Result> &results)
+{
+    out << "name,unit,ops,ns_per_op";
+    for (int c = 0; c < NUM_COUNTERS; c++)
+        out << "," << COUNTER_NAMES[c] << "_per_op";
+    out << ",ipc\n";
+    for (const auto &r : results)
+    {
+        out << r.name << ",\"" << r.unit << "\"," << r.ops << "," << number(r.nsPerOp);
+        for (int c = 0; c < NUM_COUNTERS; c++)
+            out << "," << (std::isnan(r.perOp[c]) ? "" : number(r.perOp[c]));
+        out << "," << (std::isnan(ipc(r)) ? "" : number(ipc(r))) << "\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --format=text|json|csv  --output=<file>  --filter=<substring>  --samples=N  --min-time=ms
+    //          --uavs=N  --outposts=N  --particles=N  --seed=N  --no-counters
+    string format = "text", outputPath, filter;
+    int samples = 5, numUAVs = 50, numOutposts = 2000, numParticles = 50;
+    double minSeconds = 0.02;
+    uint64_t seed = 42;
+    bool counters = true;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--format=", 0) == 0)
+            format = arg.substr(9);
+        else if (arg.rfind("--output=", 0) == 0)
+            outputPath = arg.substr(9);
+        else if (arg.rfind("--filter=", 0) == 0)
+            filter = arg.substr(9);
+        else if (arg.rfind("--samples=", 0) == 0)
+            samples = max(1, stoi(arg.substr(10)));
+        else if (arg.rfind("--min-time=", 0) == 0)
+            minSeconds = max(0.0, stod(arg.substr(11)) / 1000);
+        else if (arg.rfind("--uavs=", 0) == 0)
+            numUAVs = max(1, stoi(arg.substr(7)));
+        else if (arg.rfind("--outposts=", 0) == 0)
+            numOutposts = max(1, stoi(arg.substr(11)));
+        else if (arg.rfind("--particles=", 0) == 0)
+            numParticles = max(1, stoi(arg.substr(12)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            seed = stoull(arg.substr(7));
+        else if (arg == "--no-counters")
+            counters = false;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (format != "text" && format != "json" && format != "csv")
+    {
+        cerr << "Unknown format: " << format << " (expected text, json or csv)\n";
+        return 1;
+    }
+    if (numUAVs > numOutposts)
+    {
+        cerr << "initializeParticles_v5 needs at least as many outposts as UAVs\n";
+        return 1;
+    }
+
+    PerfCounters perf(counters);
+    string source = perf.available() ? "perf_event_open" : "steady_clock (perf_event_open: " + perf.why() + ")";
+
+    vector<Result> results;
+    for (const auto &bench : makeBenchmarks(numUAVs, numOutposts, numParticles, seed))
+        if (filter.empty() || bench.name.find(filter) != string::npos)
+            results.push_back(measure(bench, perf, samples, minSeconds));
+
+    ofstream file;
+    if (!outputPath.empty())
+    {
+        file.open(outputPath);
+        if (!file)
+        {
+            cerr << "Cannot open output file: " << outputPath << "\n";
+            return 1;
+        }
+    }
+    ostream &out = outputPath.empty() ? cout : file;
+    if (format == "json")
+        writeJson(out, results, source, numUAVs, numOutposts);
+    else if (format == "csv")
+        writeCsv(out, results);
+    else
+        writeText(out, results, source);
+
+    return 0;
+}
@@ -0,0 +1,491 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+const double PI = 3.14159265358979323846;
+const double DEG = PI / 180.0;
+const double EARTH_RADIUS_KM = 6371.0088;       // Mean radius (IUGG), for haversine
+const double WGS84_A = 6378.137;                // Semi-major axis, km
+const double WGS84_F = 1.0 / 298.257223563;     // Flattening
+const double WGS84_B = WGS84_A * (1 - WGS84_F); // Semi-minor axis, km
+const double WGS84_E2 = WGS84_F * (2 - WGS84_F); // First eccentricity squared
+const int VINCENTY_MAX_ITERATIONS = 200;
+const double VINCENTY_TOLERANCE = 1e-12; // On lambda, radians (~0.006 mm)
+const double TANGENT_MAX_KM = 1000.0;    // Straight-line distance from the base beyond which tangent falls back to haversine
+
+struct UAV
+{
+    int id;
+    double weightCapacity;
+    double energyPerKm;
+    double totalEnergy;
+    double availableTime; // Time when UAV is available again
+};
+
+struct Outpost
+{
+    int id;
+    int medicine, food, weapons;
+    double x, y; // Planar coordinates, or latitude / longitude in degrees with --distance=geo modes
+    int priority;
+};
+
+struct Task
+{
+    double time;
+    int uavIndex;
+    bool operator>(const Task &other) const
+    {
+        return time > other.time; // Min-heap based on time
+    }
+};
+
+double calculateDistance(double x1, double y1, double x2, double y2)
+{
+    return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+}
+
+// Runs work(t) for t in [0, threads); inline when there is one thread
+template <typename Work>
+void runThreads(int threads, Work work)
+{
+    if (threads == 1)
+    {
+        work(0);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.emplace_back(work, t);
+    for (auto &w : workers)
+        w.join();
+}
+
+// ---------------------------------------------------------------------------
+// Geodetic distances from the base to every outpost. Each mode first turns
+// every point into the per-point terms it needs (one sin/cos of latitude and
+// longitude per point, never per pair), stored as structure-of-arrays, then
+// runs a flat loop over those arrays.
+//
+//   haversine  sphere; points as unit vectors, so the haversine of the central
+//              angle is |p - q|^2 / 4 and the inner loop is multiply-add only
+//   vincenty   WGS84 ellipsoid, iterative inverse formula (sub-millimetre)
+//   tangent    WGS84 points projected once onto the local east/north plane at
+//              the base, then planar distance (fast, approximate). The
+//              projection drops the up component, so far points collapse
+//              towards the base (the antipode lands on it); points beyond
+//              TANGENT_MAX_KM use haversine instead
+// ---------------------------------------------------------------------------
+
+enum DistanceMode
+{
+    PLANAR,
+    HAVERSINE,
+    VINCENTY,
+    TANGENT
+};
+
+struct GeoBase
+{
+    double lat, lon; // Radians
+};
+
+// Unit vectors on the sphere
+struct SpherePoints
+{
+    vector<double> ux, uy, uz;
+};
+
+// Reduced latitude terms and longitude for Vincenty
+struct EllipsoidPoints
+{
+    vector<double> sinU, cosU, lon;
+};
+
+void toSphere(const vector<Outpost> &outposts, SpherePoints &points, size_t first, size_t last)
+{
+    for (size_t o = first; o < last; o++)
+    {
+        double lat = outposts[o].x * DEG, lon = outposts[o].y * DEG;
+        double cosLat = cos(lat);
+        points.ux[o] = cosLat * cos(lon);
+        points.uy[o] = cosLat * sin(lon);
+        points.uz[o] = sin(lat);
+    }
+}
+
+void haversineDistances(const SpherePoints &points, const GeoBase &base, double *distance, size_t first, size_t last)
+{
+    double bx = cos(base.lat) * cos(base.lon), by = cos(base.lat) * sin(base.lon), bz = sin(base.lat);
+    const double *ux = points.ux.data(), *uy = points.uy.data(), *uz = points.uz.data();
+    // Pass 1 vectorises: haversine of the central angle from the chord
+    for (size_t o = first; o < last; o++)
+    {
+        double dx = ux[o] - bx, dy = uy[o] - by, dz = uz[o] - bz;
+        distance[o] = 0.25 * (dx * dx + dy * dy + dz * dz);
+    }
+    // Pass 2: central angle = 2 asin(sqrt(hav))
+    for (size_t o = first; o < last; o++)
+        distance[o] = 2 * EARTH_RADIUS_KM * asin(min(1.0, sqrt(distance[o])));
+}
+
+void toEllipsoid(const vector<Outpost> &outposts, EllipsoidPoints &points, size_t first, size_t last)
+{
+    for (size_t o = first; o < last; o++)
+    {
+        double tanU = (1 - WGS84_F) * tan(outposts[o].x * DEG);
+        double cosU = 1 / sqrt(1 + tanU * tanU);
+        points.cosU[o] = cosU;
+        points.sinU[o] = tanU * cosU;
+        points.lon[o] = outposts[o].y * DEG;
+    }
+}
+
+// Vincenty inverse on WGS84. Returns a negative value if the iteration does
+// not converge (nearly antipodal points).
+double vincenty(double sinU1, double cosU1, double lon1, double sinU2, double cosU2, double lon2)
+{
+    double L = lon2 - lon1, lambda = L;
+    double sinSigma, cosSigma, sigma, cosSqAlpha, cos2SigmaM;
+    for (int i = 0; i < VINCENTY_MAX_ITERATIONS; i++)
+    {
+        double sinLambda = sin(lambda), cosLambda = cos(lambda);
+        double t1 = cosU2 * sinLambda, t2 = cosU1 * sinU2 - sinU1 * cosU2 * cosLambda;
+        sinSigma = sqrt(t1 * t1 + t2 * t2);
+        if (sinSigma == 0)
+            return 0; // Coincident points
+        cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cosLambda;
+        sigma = atan2(sinSigma, cosSigma);
+        double sinAlpha = cosU1 * cosU2 * sinLambda / sinSigma;
+        cosSqAlpha = 1 - sinAlpha * sinAlpha;
+        cos2SigmaM = cosSqAlpha != 0 ? cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha : 0; // Equatorial line
+        double C = WGS84_F / 16 * cosSqAlpha * (4 + WGS84_F * (4 - 3 * cosSqAlpha));
+        double previous = lambda;
+        lambda = L + (1 - C) * WGS84_F * sinAlpha *
+                         (sigma + C * sinSigma * (cos2SigmaM + C * cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM)));
+        if (fabs(lambda - previous) < VINCENTY_TOLERANCE)
+        {
+            double uSq = cosSqAlpha * (WGS84_A * WGS84_A - WGS84_B * WGS84_B) / (WGS84_B * WGS84_B);
+            double A = 1 + uSq / 16384 * (4096 + uSq * (-768 + uSq * (320 - 175 * uSq)));
+            double B = uSq / 1024 * (256 + uSq * (-128 + uSq * (74 - 47 * uSq)));
+            double deltaSigma =
+                B * sinSigma *
+                (cos2SigmaM + B / 4 *
+                                  (cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM) -
+                                   B / 6 * cos2SigmaM * (-3 + 4 * sinSigma * sinSigma) *
+                                       (-3 + 4 * cos2SigmaM * cos2SigmaM)));
+            return WGS84_B * A * (sigma - deltaSigma);
+        }
+    }
+    return -1;
+}
+
+// Haversine for a single point, for the modes that fall back to it
+double haversineKm(const GeoBase &base, double latDeg, double lonDeg)
+{
+    double lat = latDeg * DEG, lon = lonDeg * DEG;
+    double h = pow(sin((lat - base.lat) / 2), 2) + cos(base.lat) * cos(lat) * pow(sin((lon - base.lon) / 2), 2);
+    return 2 * EARTH_RADIUS_KM * asin(min(1.0, sqrt(h)));
+}
+
+// Returns how many points fell back to haversine because Vincenty did not converge
+size_t vincentyDistances(const vector<Outpost> &outposts, const EllipsoidPoints &points, const GeoBase &base,
+                         double *distance, size_t first, size_t last)
+{
+    double tanU1 = (1 - WGS84_F) * tan(base.lat);
+    double cosU1 = 1 / sqrt(1 + tanU1 * tanU1), sinU1 = tanU1 * cosU1;
+    size_t fallbacks = 0;
+    for (size_t o = first; o < last; o++)
+    {
+        distance[o] = vincenty(sinU1, cosU1, base.lon, points.sinU[o], points.cosU[o], points.lon[o]);
+        if (distance[o] < 0)
+        {
+            distance[o] = haversineKm(base, outposts[o].x, outposts[o].y);
+            fallbacks++;
+        }
+    }
+    return fallbacks;
+}
+
+// WGS84 ECEF of a surface point, km
+void toEcef(double lat, double lon, double &x, double &y, double &z)
+{
+    double sinLat = sin(lat), cosLat = cos(lat);
+    double n = WGS84_A / sqrt(1 - WGS84_E2 * sinLat * sinLat);
+    x = n * cosLat * cos(lon);
+    y = n * cosLat * sin(lon);
+    z = n * (1 - WGS84_E2) * sinLat;
+}
+
+// East/north coordinates in the tangent plane at the base, then planar
+// distance. Returns how many points were too far for the plane and fell back
+// to haversine.
+size_t tangentDistances(const vector<Outpost> &outposts, const GeoBase &base, vector<double> &east,
+                        vector<double> &north, double *distance, size_t first, size_t last)
+{
+    double bx, by, bz;
+    toEcef(base.lat, base.lon, bx, by, bz);
+    double sinLat0 = sin(base.lat), cosLat0 = cos(base.lat), sinLon0 = sin(base.lon), cosLon0 = cos(base.lon);
+    vector<size_t> far;
+    for (size_t o = first; o < last; o++)
+    {
+        double x, y, z;
+        toEcef(outposts[o].x * DEG, outposts[o].y * DEG, x, y, z);
+        double dx = x - bx, dy = y - by, dz = z - bz;
+        east[o] = -sinLon0 * dx + cosLon0 * dy;
+        north[o] = -sinLat0 * cosLon0 * dx - sinLat0 * sinLon0 * dy + cosLat0 * dz;
+        if (dx * dx + dy * dy + dz * dz > TANGENT_MAX_KM * TANGENT_MAX_KM)
+            far.push_back(o);
+    }
+    for (size_t o = first; o < last; o++)
+        distance[o] = sqrt(east[o] * east[o] + north[o] * north[o]);
+    for (size_t o : far)
+        distance[o] = haversineKm(base, outposts[o].x, outposts[o].y);
+    return far.size();
+}
+
+struct DistanceResult
+{
+    vector<double> distance;
+    size_t fallbacks = 0;
+    double seconds = 0;
+};
+
+DistanceResult computeDistances(DistanceMode mode, const vector<Outpost> &outposts, double baseX, double baseY,
+                                int threads)
+{
+    auto start = chrono::steady_clock::now();
+    size_t n = outposts.size();
+    DistanceResult result;
+    result.distance.assign(n, 0.0);
+    GeoBase base{baseX * DEG, baseY * DEG};
+    SpherePoints sphere;
+    EllipsoidPoints ellipsoid;
+    vector<double> east, north;
+    if (mode == HAVERSINE)
+        sphere = {vector<double>(n), vector<double>(n), vector<double>(n)};
+    else if (mode == VINCENTY)
+        ellipsoid = {vector<double>(n), vector<double>(n), vector<double>(n)};
+    else if (mode == TANGENT)
+    {
+        east.resize(n);
+        north.resize(n);
+    }
+
+    vector<size_t> fallbacks(threads, 0);
+    size_t chunk = (n + threads - 1) / threads;
+    runThreads(threads, [&](int t)
+               {
+                   size_t first = min(n, t * chunk), last = min(n, first + chunk);
+                   double *distance = result.distance.data();
+                   switch (mode)
+                   {
+                   case PLANAR:
+                       for (size_t o = first; o < last; o++)
+                           distance[o] = calculateDistance(baseX, baseY, outposts[o].x, outposts[o].y);
+                       break;
+                   case HAVERSINE:
+                       toSphere(outposts, sphere, first, last);
+                       haversineDistances(sphere, base, distance, first, last);
+                       break;
+                   case VINCENTY:
+                       toEllipsoid(outposts, ellipsoid, first, last);
+                       fallbacks[t] = vincentyDistances(outposts, ellipsoid, base, distance, first, last);
+                       break;
+                   case TANGENT:
+                       fallbacks[t] = tangentDistances(outposts, base, east, north, distance, first, last);
+                       break;
+                   } });
+    for (size_t f : fallbacks)
+        result.fallbacks += f;
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --distance=planar|haversine|vincenty|tangent  --threads=N  --compare  --quiet
+    DistanceMode mode = PLANAR;
+    int threads = 1;
+    bool compare = false, quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--distance=planar")
+            mode = PLANAR;
+        else if (arg == "--distance=haversine")
+            mode = HAVERSINE;
+        else if (arg == "--distance=vincenty")
+            mode = VINCENTY;
+        else if (arg == "--distance=tangent")
+            mode = TANGENT;
+        else if (arg.rfind("--threads=", 0) == 0)
+            threads = max(1, stoi(arg.substr(10)));
+        else if (arg == "--compare")
+            compare = true;
+        else if (arg == "--quiet")
+            quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+    bool geo = mode != PLANAR;
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<UAV> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].weightCapacity >> uavs[i].energyPerKm >> uavs[i].totalEnergy;
+        uavs[i].availableTime = 0; // Initially all UAVs are available
+    }
+
+    double baseX, baseY;
+    cout << (geo ? "Enter Base Station latitude and longitude (degrees): " : "Enter Base Station coordinates (x y): ");
+    cin >> baseX >> baseY;
+
+    vector<Outpost> outposts(numOutposts);
+    cout << (geo ? "Enter Outpost details (ID, medicine, food, weapons, latitude, longitude, priority level 1-5):\n"
+                 : "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n");
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >>
+            outposts[i].y >> outposts[i].priority;
+    }
+
+    if (geo)
+    {
+        auto invalid = [](double lat, double lon) { return !(fabs(lat) <= 90) || !(fabs(lon) <= 180); };
+        if (invalid(baseX, baseY))
+        {
+            cerr << "Base Station latitude/longitude out of range\n";
+            return 1;
+        }
+        for (const auto &outpost : outposts)
+            if (invalid(outpost.x, outpost.y))
+            {
+                cerr << "Outpost " << outpost.id << ": latitude/longitude out of range\n";
+                return 1;
+            }
+    }
+
+    DistanceResult distances = computeDistances(mode, outposts, baseX, baseY, threads);
+
+    // Outposts and their distances move together through the priority sort
+    vector<int> order(numOutposts);
+    for (int i = 0; i < numOutposts; i++)
+        order[i] = i;
+    sort(order.begin(), order.end(), [&](int a, int b) { return outposts[a].priority > outposts[b].priority; });
+
+    // Min-heap to track UAV availability based on earliest available time
+    priority_queue<Task, vector<Task>, greater<Task>> pq;
+    for (int i = 0; i < numUAVs; i++)
+    {
+        pq.push({0, i}); // All UAVs start at time 0
+    }
+
+    if (!quiet)
+        cout << "\nBest UAV Allocation:\n";
+    long long assignedCount = 0, unreachable = 0;
+    double totalEnergy = 0, makespan = 0;
+    vector<Task> tempUAVs; // Store popped elements to push them back later
+    for (int o : order)
+    {
+        const Outpost &outpost = outposts[o];
+        double distance = distances.distance[o];
+        bool assigned = false;
+        int selectedUAV = -1;
+        double selectedEnergyUsed = 0, selectedTravelTime = 0;
+        tempUAVs.clear();
+
+        while (!pq.empty())
+        {
+            auto [availableTime, uavIndex] = pq.top();
+            pq.pop();
+            UAV &uav = uavs[uavIndex];
+
+            double energyCost = distance * uav.energyPerKm * 2; // Round trip
+            double travelTime = distance / 10.0;                // Assume 10 units speed
+
+            if (energyCost <= uav.totalEnergy)
+            {
+                assigned = true;
+                selectedUAV = uavIndex;
+                selectedEnergyUsed = energyCost;
+                selectedTravelTime = travelTime;
+
+                // Update UAV availability
+                uav.availableTime = availableTime + (2 * travelTime);
+                pq.push({uav.availableTime, uavIndex});
+                break;
+            }
+            tempUAVs.push_back({availableTime, uavIndex});
+        }
+
+        // Push back UAVs that were not selected
+        for (auto &task : tempUAVs)
+            pq.push(task);
+
+        if (assigned)
+        {
+            assignedCount++;
+            totalEnergy += selectedEnergyUsed;
+            makespan = max(makespan, uavs[selectedUAV].availableTime);
+            if (!quiet)
+                cout << "UAV " << uavs[selectedUAV].id << " assigned to Outpost " << outpost.id
+                     << " | Distance: " << distance << " | Energy Cost: " << selectedEnergyUsed
+                     << " | Travel Time: " << selectedTravelTime << " | Available Again At: " << uavs[selectedUAV].availableTime
+                     << "\n";
+        }
+        else
+        {
+            unreachable++;
+            if (!quiet)
+                cout << "⚠️ Warning: Outpost " << outpost.id << " could not be reached due to UAV constraints.\n";
+        }
+    }
+
+    const char *const modeNames[] = {"planar", "haversine", "vincenty", "tangent"};
+    cout << "\nAssigned: " << assignedCount << " | Unreachable: " << unreachable << " | Total Energy: " << totalEnergy
+         << " | Makespan: " << makespan << "\n";
+    cout << "Distances: " << modeNames[mode] << ", " << numOutposts << " points, " << threads << " thread(s), "
+         << distances.seconds << " s";
+    if (distances.fallbacks > 0)
+        cout << " (" << distances.fallbacks << " " << modeNames[mode] << " fallbacks to haversine)";
+    cout << "\n";
+
+    if (compare && geo)
+    {
+        DistanceResult reference = computeDistances(VINCENTY, outposts, baseX, baseY, threads);
+        double maxError = 0, maxRelative = 0, sumError = 0;
+        for (int o = 0; o < numOutposts; o++)
+        {
+            double error = fabs(distances.distance[o] - reference.distance[o]);
+            maxError = max(maxError, error);
+            if (reference.distance[o] > 0)
+                maxRelative = max(maxRelative, error / reference.distance[o]);
+            sumError += error;
+        }
+        cout << "Against Vincenty: max error " << maxError * 1000 << " m, mean " << sumError / max(1, numOutposts) * 1000
+             << " m, max relative " << maxRelative * 100 << "% (Vincenty took " << reference.seconds << " s)\n";
+    }
+
+    return 0;
+}
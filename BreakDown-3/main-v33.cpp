@@ -0,0 +1,703 @@
+#include "uav_solver.h"
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+// Deadline meta-solver over the v28 library: answers with the greedy plan at
+// once, then spends whatever budget is left on local search and PSO, chosen
+// and sized by a calibrated cost model, and returns the best plan by the deadline
+
+typedef chrono::steady_clock Clock;
+
+const char *DEFAULT_MODEL_FILE = "uav_cost_model.txt";
+const double SAFETY_MARGIN = 0.1;     // Share of the budget kept back for cancellation and copying
+const double MIN_MARGIN_MS = 4.0;     // About one scheduler wake-up on a busy core
+const int MIN_PSO_ITERATIONS = 5;     // Fewer is not worth starting
+const int MIN_PSO_PARTICLES = 10;
+const double SLOWDOWN_WEIGHT = 0.3;   // EWMA weight of the newest sample
+const double MIN_TIMED_MS = 1.0;      // Shorter stages are mostly scheduling noise; not fed to the slowdown
+
+double elapsedMs(Clock::time_point since)
+{
+    return chrono::duration<double, milli>(Clock::now() - since).count();
+}
+
+// Predicted milliseconds per solver, from the shapes of their loops:
+//   greedy: stable_sort of the outposts, then each outpost scans the idle UAVs
+//   local:  greedy seed, reach lists (n·m), then relocate/swap passes
+//   PSO:    greedy seed, reach lists, then particles·(m + n) per iteration (move, repair, evaluate)
+struct CostModel
+{
+    double startup = 0.2;      // Per solve: worker thread, Problem setup, plan copy
+    double greedySort = 2e-5;  // × n·log2(n)
+    double greedyScan = 4e-6;  // × n·m
+    double localScan = 1.2e-5; // × n·m
+    double psoSetup = 6e-6;    // × n·m
+    double psoStep = 2e-5;     // × particles·(m + n), per iteration including the initial swarm
+
+    double greedy(double n, double m) const
+    {
+        return startup + greedySort * n * log2(max(n, 2.0)) + greedyScan * n * m;
+    }
+    double local(double n, double m) const { return greedy(n, m) + localScan * n * m; }
+    double pso(double n, double m, int particles, int iterations) const
+    {
+        return greedy(n, m) + psoSetup * n * m + psoStep * particles * (m + n) * (iterations + 1);
+    }
+
+    // All six coefficients or none: a truncated file leaves the model untouched
+    bool load(const string &path)
+    {
+        ifstream in(path);
+        CostModel read;
+        if (!(in >> read.startup >> read.greedySort >> read.greedyScan >> read.localScan >> read.psoSetup >>
+              read.psoStep))
+            return false;
+        *this = read;
+        return true;
+    }
+
+    bool save(const string &path) const
+    {
+        ofstream out(path);
+        out.precision(6);
+        out << scientific << startup << " " << greedySort << " " << greedyScan << " " << localScan << " "
+            << psoSetup << " " << psoStep << "\n";
+        return (bool)out;
+    }
+};
+
+// What the process's own load does to solve times. Shared by every request:
+//  - solves in flight share the cores, so a prediction is stretched by
+//    in-flight / cores before anything has been measured;
+//  - what that still misses (cache pressure, other processes, a model fitted
+//    on another instance) is an actual/predicted ratio smoothed over recent stages;
+//  - a cancelled solve takes time to hand back its plan, also smoothed.
+// Under a surge all three rise together, so requests plan smaller refinements
+// and stop them earlier. Refinements also need one of `cores` slots: a request
+// that finds them all taken answers with its greedy plan rather than slowing
+// every other request down. Greedy solves, the floor every request needs,
+// take turns on their own `cores` slots in arrival order, and no refinement
+// starts while one is running or waiting: a refinement would take half the
+// core from every greedy solve queued behind it.
+class LoadEstimate
+{
+public:
+    // Multiplier for the model's prediction of a solve started now
+    double slowdown() const
+    {
+        double share = max(1.0, (inFlight.load(memory_order_relaxed) + 1) / cores);
+        lock_guard<mutex> lock(m);
+        return factor * share;
+    }
+
+    void begin() { inFlight.fetch_add(1, memory_order_relaxed); }
+    void end() { inFlight.fetch_sub(1, memory_order_relaxed); }
+
+    // Returns this request's greedy turn; turns are served in order
+    long long takeGreedyTurn()
+    {
+        lock_guard<mutex> lock(m);
+        return nextTurn++;
+    }
+
+    // Greedy solves ahead of a turn, running or waiting, as a multiple of the cores
+    double greedyQueue(long long turn) const
+    {
+        lock_guard<mutex> lock(m);
+        return (turn - finishedTurns) / cores;
+    }
+
+    void waitGreedyTurn(long long turn)
+    {
+        unique_lock<mutex> lock(m);
+        turnReady[turn % TURN_RING].wait(lock, [&] { return turn < finishedTurns + cores; });
+    }
+
+    void endGreedyTurn()
+    {
+        // Wake only the turn that can now run: waking every waiter on each
+        // hand-over costs a context switch per waiting request
+        long long next;
+        {
+            lock_guard<mutex> lock(m);
+            next = ++finishedTurns + (long long)cores - 1;
+        }
+        turnReady[next % TURN_RING].notify_all();
+    }
+
+    bool tryRefine()
+    {
+        {
+            lock_guard<mutex> lock(m);
+            if (nextTurn > finishedTurns)
+                return false; // Greedy solves are running or waiting
+        }
+        int busy = refining.load(memory_order_relaxed);
+        while (busy < cores)
+            if (refining.compare_exchange_weak(busy, busy + 1, memory_order_acquire))
+                return true;
+        return false;
+    }
+    void endRefine() { refining.fetch_sub(1, memory_order_release); }
+
+    double cancelMs() const
+    {
+        lock_guard<mutex> lock(m);
+        return cancelLatency;
+    }
+
+    // expectedMs is the model's prediction times the slowdown() it was planned with
+    void record(double actualMs, double expectedMs)
+    {
+        if (expectedMs < MIN_TIMED_MS)
+            return;
+        double ratio = min(50.0, max(0.2, actualMs / expectedMs));
+        lock_guard<mutex> lock(m);
+        factor = min(MAX_FACTOR, max(MIN_FACTOR, (1 - SLOWDOWN_WEIGHT) * factor + SLOWDOWN_WEIGHT * factor * ratio));
+    }
+
+    void recordCancel(double ms)
+    {
+        lock_guard<mutex> lock(m);
+        cancelLatency = (1 - SLOWDOWN_WEIGHT) * cancelLatency + SLOWDOWN_WEIGHT * ms;
+    }
+
+private:
+    // Bounded, so that a burst of cut-short stages cannot shut refinement off
+    // for good: only refinements that run can bring the factor back down
+    const double MIN_FACTOR = 0.5, MAX_FACTOR = 4.0;
+    const double cores = max(1u, thread::hardware_concurrency());
+    atomic<int> inFlight{0};
+    atomic<int> refining{0};
+    mutable mutex m;
+    static const int TURN_RING = 64; // Turns share a condition variable only TURN_RING apart
+    condition_variable turnReady[TURN_RING];
+    long long nextTurn = 0, finishedTurns = 0;
+    double factor = 1.0;
+    double cancelLatency = 0.0;
+};
+
+enum Stage
+{
+    STAGE_GREEDY,
+    STAGE_LOCAL,
+    STAGE_PSO
+};
+
+const char *stageName(Stage stage)
+{
+    switch (stage)
+    {
+    case STAGE_GREEDY:
+        return "greedy";
+    case STAGE_LOCAL:
+        return "local";
+    case STAGE_PSO:
+        return "pso";
+    }
+    return "?";
+}
+
+struct Settings
+{
+    double budgetMs = 100;
+    uav_options pso = uav::defaultOptions();
+    string modelFile = DEFAULT_MODEL_FILE;
+    bool calibrate = false, quiet = false;
+    int surge = 0, requests = 20;
+};
+
+struct Answer
+{
+    uav::Plan plan;
+    Stage stage = STAGE_GREEDY; // Stage that found the returned plan
+    double latencyMs = 0;
+    bool degraded = false;      // A refinement stage was skipped or cut short
+    bool infeasible = false;    // The greedy floor alone was predicted to miss the budget
+    double greedyPredictedMs = 0; // Including the wait for a greedy turn
+};
+
+// Runs one solver until it finishes or the deadline, whichever comes first.
+// Returns false if it had to be cancelled.
+bool runUntil(const uav::Instance &instance, const uav_options &options, Clock::time_point deadline,
+              uav::Plan &plan, LoadEstimate &load)
+{
+    const auto POLL = chrono::microseconds(50);
+    load.begin();
+    uav::Solve solve = uav::solveAsync(instance, options);
+    auto left = chrono::duration_cast<chrono::milliseconds>(deadline - Clock::now());
+    uav_status status = solve.waitFor(max(left, chrono::milliseconds(0)));
+    // waitFor has millisecond resolution; poll out the remainder
+    while (status == UAV_RUNNING && Clock::now() < deadline)
+    {
+        this_thread::sleep_for(POLL);
+        if (solve.done())
+            status = solve.wait();
+    }
+    bool finished = status != UAV_RUNNING;
+    if (!finished)
+    {
+        // Counted from the deadline: waking this thread on a busy core is
+        // part of the delay, not just the solver noticing the flag
+        solve.cancel();
+        status = solve.wait();
+        plan = solve.best();
+        load.recordCancel(elapsedMs(deadline));
+    }
+    else
+        plan = solve.best();
+    load.end();
+    if (status != UAV_OK && status != UAV_CANCELLED)
+        throw runtime_error(string("solve failed: ") + uav_status_string(status));
+    return finished && status == UAV_OK;
+}
+
+struct RefineSlot
+{
+    LoadEstimate &load;
+    ~RefineSlot() { load.endRefine(); }
+};
+
+struct GreedyTurn
+{
+    LoadEstimate &load;
+    ~GreedyTurn() { load.endGreedyTurn(); }
+};
+
+class MetaSolver
+{
+public:
+    MetaSolver(const uav::Instance &instance, const CostModel &model, const Settings &settings, LoadEstimate &load)
+        : instance(instance), model(model), settings(settings), load(load),
+          n(instance.outposts.size()), m(instance.uavs.size())
+    {
+    }
+
+    // onInfeasible is called with the predicted greedy time, before greedy
+    // starts, if that alone would miss the budget; onGreedy is called with the
+    // first plan as soon as it exists
+    template <typename InfeasibleCallback, typename GreedyCallback>
+    Answer solveWithin(double budgetMs, InfeasibleCallback onInfeasible, GreedyCallback onGreedy)
+    {
+        auto start = Clock::now();
+        auto deadline = start + chrono::microseconds((long long)(budgetMs * 1000));
+        // Refinements stop this far before the deadline, to leave time for a
+        // cancelled solve to return
+        double margin = max({MIN_MARGIN_MS, SAFETY_MARGIN * budgetMs, 2 * load.cancelMs()});
+        Answer answer;
+
+        // The greedy plan is the floor: it always runs to completion, since a
+        // cancelled one may not have assigned anything yet. A budget it cannot
+        // meet is reported before it starts, and then answered late.
+        uav_options options = settings.pso;
+        options.solver = UAV_SOLVER_GREEDY;
+        long long turn = load.takeGreedyTurn();
+        double expected = model.greedy(n, m) * load.slowdown();
+        answer.greedyPredictedMs = expected * (1 + load.greedyQueue(turn));
+        if (answer.greedyPredictedMs > budgetMs)
+        {
+            answer.infeasible = answer.degraded = true;
+            onInfeasible(answer.greedyPredictedMs);
+        }
+        {
+            GreedyTurn greedyTurn{load};
+            load.waitGreedyTurn(turn);
+            auto greedyStart = Clock::now();
+            load.begin();
+            answer.plan = uav::solve(instance, options);
+            load.end();
+            load.record(elapsedMs(greedyStart), expected);
+        }
+        onGreedy(answer.plan, elapsedMs(start));
+
+        // With every core already refining someone else's plan, starting
+        // another would only make all of them late
+        if (!load.tryRefine())
+        {
+            answer.degraded = true;
+            answer.latencyMs = elapsedMs(start);
+            return answer;
+        }
+        RefineSlot slot{load};
+        auto stopBy = deadline - chrono::microseconds((long long)(margin * 1000));
+
+        // Local search next: the most improvement per millisecond
+        options.solver = UAV_SOLVER_LOCAL;
+        expected = model.local(n, m) * load.slowdown();
+        if (elapsedMs(start) + expected <= budgetMs - margin)
+            refine(options, expected, STAGE_LOCAL, stopBy, answer);
+        else
+            answer.degraded = true;
+
+        // PSO with whatever is left, shrinking the swarm and then the
+        // iteration count to fit
+        options = settings.pso;
+        options.solver = UAV_SOLVER_PSO;
+        double scale = load.slowdown();
+        double left = (budgetMs - margin - elapsedMs(start)) / scale;
+        while (options.particles > MIN_PSO_PARTICLES &&
+               model.pso(n, m, options.particles, MIN_PSO_ITERATIONS) > left)
+            options.particles = max(MIN_PSO_PARTICLES, options.particles / 2);
+        // In double until clamped: a calibrated psoStep of 0 or a negative
+        // remainder must not reach the int conversion
+        double perIteration = model.psoStep * options.particles * (m + n);
+        double setupMs = model.pso(n, m, options.particles, 0);
+        double iterations = perIteration > 0 ? (left - setupMs) / perIteration
+                                             : (left >= setupMs ? settings.pso.iterations : 0);
+        options.iterations = (int)min((double)settings.pso.iterations, max(0.0, iterations));
+        if (options.iterations >= MIN_PSO_ITERATIONS)
+        {
+            expected = model.pso(n, m, options.particles, options.iterations) * scale;
+            refine(options, expected, STAGE_PSO, stopBy, answer);
+            if (options.iterations < settings.pso.iterations || options.particles < settings.pso.particles)
+                answer.degraded = true;
+        }
+        else
+            answer.degraded = true;
+
+        answer.latencyMs = elapsedMs(start);
+        return answer;
+    }
+
+private:
+    void refine(const uav_options &options, double expectedMs, Stage stage, Clock::time_point stopBy,
+                Answer &answer)
+    {
+        auto start = Clock::now();
+        uav::Plan plan;
+        if (runUntil(instance, options, stopBy, plan, load))
+            load.record(elapsedMs(start), expectedMs);
+        else
+        {
+            // Cut short: the estimate was optimistic by at least this much
+            load.record(elapsedMs(start) * 2, expectedMs);
+            answer.degraded = true;
+        }
+        if (plan.summary.fitness < answer.plan.summary.fitness)
+        {
+            answer.plan = move(plan);
+            answer.stage = stage;
+        }
+    }
+
+    const uav::Instance &instance;
+    const CostModel &model;
+    const Settings &settings;
+    LoadEstimate &load;
+    double n, m;
+};
+
+// -----------------------------------------------------------------------
+// Calibration: time each solver on random instances of a few sizes and fit
+// the model's coefficients by least squares
+// -----------------------------------------------------------------------
+
+struct RandomInstance
+{
+    vector<uav_spec> uavs;
+    vector<uav_outpost> outposts;
+    uav::Instance instance;
+
+    RandomInstance(int n, int m, unsigned seed)
+    {
+        mt19937 rng(seed);
+        uniform_real_distribution<double> coord(-100.0, 100.0), rate(0.5, 3.0), range(50.0, 300.0);
+        uniform_int_distribution<int> supply(0, 20), priority(1, 5);
+        uavs.resize(m);
+        for (int u = 0; u < m; u++)
+            uavs[u] = {u + 1, 50.0, rate(rng), range(rng)};
+        outposts.resize(n);
+        for (int o = 0; o < n; o++)
+            outposts[o] = {o + 1, supply(rng), supply(rng), supply(rng), coord(rng), coord(rng), priority(rng)};
+        instance.uavs = uavs;
+        instance.outposts = outposts;
+    }
+};
+
+// Timed the way MetaSolver runs a refinement: on a worker thread, waited for
+// from this one. Its greedy stage runs on the caller, so that prediction errs long.
+double timeSolve(const uav::Instance &instance, const uav_options &options, int repeat)
+{
+    double best = 1e300;
+    for (int r = 0; r < repeat; r++)
+    {
+        auto start = Clock::now();
+        uav::solveAsync(instance, options).wait();
+        best = min(best, elapsedMs(start));
+    }
+    return best;
+}
+
+// Least squares for t ≈ a·x + b·y
+void fit2(const vector<double> &x, const vector<double> &y, const vector<double> &t, double &a, double &b)
+{
+    double xx = 0, xy = 0, yy = 0, xt = 0, yt = 0;
+    for (size_t i = 0; i < t.size(); i++)
+    {
+        xx += x[i] * x[i];
+        xy += x[i] * y[i];
+        yy += y[i] * y[i];
+        xt += x[i] * t[i];
+        yt += y[i] * t[i];
+    }
+    double det = xx * yy - xy * xy;
+    a = max(0.0, (xt * yy - yt * xy) / det);
+    b = max(0.0, (yt * xx - xt * xy) / det);
+}
+
+// Least squares for t ≈ a·x
+double fit1(const vector<double> &x, const vector<double> &t)
+{
+    double xx = 0, xt = 0;
+    for (size_t i = 0; i < t.size(); i++)
+    {
+        xx += x[i] * x[i];
+        xt += x[i] * t[i];
+    }
+    return max(0.0, xt / xx);
+}
+
+CostModel calibrate(bool quiet)
+{
+    const int PROBES[][2] = {{500, 20}, {2000, 50}, {4000, 200}, {8000, 100}, {20000, 50}};
+    const int PROBE_PARTICLES = 20, PROBE_ITERATIONS = 20, REPEAT = 3;
+
+    CostModel model;
+    RandomInstance tiny(1, 1, 7);
+    uav_options startupOptions = uav::defaultOptions();
+    startupOptions.solver = UAV_SOLVER_GREEDY;
+    model.startup = timeSolve(tiny.instance, startupOptions, 20);
+
+    vector<double> nlogn, nm, step, greedyMs, localMs, psoSetupMs, psoIterMs;
+    for (const auto &probe : PROBES)
+    {
+        double n = probe[0], m = probe[1];
+        RandomInstance random(probe[0], probe[1], 7);
+        uav_options options = uav::defaultOptions();
+        options.particles = PROBE_PARTICLES;
+        options.patience = PROBE_ITERATIONS;
+
+        options.solver = UAV_SOLVER_GREEDY;
+        double greedy = timeSolve(random.instance, options, REPEAT);
+        options.solver = UAV_SOLVER_LOCAL;
+        double local = timeSolve(random.instance, options, REPEAT);
+        options.solver = UAV_SOLVER_PSO;
+        options.iterations = 0;
+        double pso0 = timeSolve(random.instance, options, REPEAT);
+        options.iterations = PROBE_ITERATIONS;
+        double psoN = timeSolve(random.instance, options, REPEAT);
+
+        nlogn.push_back(n * log2(n));
+        nm.push_back(n * m);
+        step.push_back(PROBE_PARTICLES * (m + n));
+        greedyMs.push_back(greedy - model.startup);
+        localMs.push_back(local - greedy);
+        psoIterMs.push_back((psoN - pso0) / PROBE_ITERATIONS);
+        psoSetupMs.push_back(pso0 - greedy);
+        if (!quiet)
+            cout << "Probe n=" << probe[0] << " m=" << probe[1] << ": greedy " << greedy << " ms | local " << local
+                 << " ms | pso(0) " << pso0 << " ms | pso(" << PROBE_ITERATIONS << ") " << psoN << " ms\n";
+    }
+
+    fit2(nlogn, nm, greedyMs, model.greedySort, model.greedyScan);
+    model.localScan = fit1(nm, localMs);
+    model.psoStep = fit1(step, psoIterMs);
+    for (size_t i = 0; i < psoSetupMs.size(); i++)
+        psoSetupMs[i] -= model.psoStep * step[i]; // The initial swarm counts as one iteration
+    model.psoSetup = fit1(nm, psoSetupMs);
+    return model;
+}
+
+void printPlan(const uav::Plan &plan, bool quiet)
+{
+    if (!quiet)
+    {
+        cout << "\nBest UAV Allocation:\n";
+        for (const auto &a : plan.assignments)
+            cout << "UAV " << a.uav_id << " assigned to Outpost " << a.outpost_id << " with Energy Cost: " << a.energy
+                 << "\n";
+    }
+    cout << "Assigned: " << plan.summary.assigned << " | Unreachable: " << plan.summary.unreachable
+         << " | Total Energy: " << plan.summary.total_energy << " | Fitness: " << plan.summary.fitness << "\n";
+}
+
+// K client threads, each sending its requests back to back, all sharing one
+// load estimate
+void runSurge(const uav::Instance &instance, const CostModel &model, const Settings &settings)
+{
+    LoadEstimate load;
+    vector<Answer> answers(settings.surge * settings.requests);
+    vector<thread> clients;
+    auto start = Clock::now();
+    for (int k = 0; k < settings.surge; k++)
+        clients.emplace_back([&, k] {
+            MetaSolver solver(instance, model, settings, load);
+            for (int r = 0; r < settings.requests; r++)
+                answers[k * settings.requests + r] =
+                    solver.solveWithin(settings.budgetMs, [](double) {}, [](const uav::Plan &, double) {});
+        });
+    for (auto &t : clients)
+        t.join();
+    double wallMs = elapsedMs(start);
+
+    vector<double> latency;
+    int misses = 0, degraded = 0, infeasible = 0, byStage[3] = {0, 0, 0};
+    double fitness = 0;
+    for (const auto &a : answers)
+    {
+        latency.push_back(a.latencyMs);
+        misses += a.latencyMs > settings.budgetMs;
+        degraded += a.degraded;
+        infeasible += a.infeasible;
+        byStage[a.stage]++;
+        fitness += a.plan.summary.fitness;
+    }
+    sort(latency.begin(), latency.end());
+    auto percentile = [&](double q) { return latency[min(latency.size() - 1, (size_t)(q * latency.size()))]; };
+
+    cout << "Surge: " << settings.surge << " clients x " << settings.requests << " requests | Budget: "
+         << settings.budgetMs << " ms | Wall: " << wallMs << " ms\n";
+    cout << "Latency p50: " << percentile(0.5) << " ms | p99: " << percentile(0.99)
+         << " ms | max: " << latency.back() << " ms | Deadline misses: " << misses
+         << " (predicted infeasible: " << infeasible << ")\n";
+    cout << "Best plan from greedy: " << byStage[STAGE_GREEDY] << " | local: " << byStage[STAGE_LOCAL]
+         << " | pso: " << byStage[STAGE_PSO] << " | Degraded: " << degraded
+         << " | Mean fitness: " << fitness / answers.size() << "\n";
+    cout << "Final slowdown: " << load.slowdown() << " | Cancel latency: " << load.cancelMs() << " ms\n";
+}
+
+int main(int argc, char **argv)
+{
+    // Options: --budget=ms  --particles=N  --iterations=N  --seed=N  --model=file  --calibrate
+    //          --surge=K  --requests=N  --quiet
+    Settings settings;
+    settings.pso.patience = settings.pso.iterations;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--budget=", 0) == 0)
+            settings.budgetMs = stod(arg.substr(9));
+        else if (arg.rfind("--particles=", 0) == 0)
+            settings.pso.particles = max(MIN_PSO_PARTICLES, stoi(arg.substr(12)));
+        else if (arg.rfind("--iterations=", 0) == 0)
+            settings.pso.iterations = settings.pso.patience = max(0, stoi(arg.substr(13)));
+        else if (arg.rfind("--seed=", 0) == 0)
+            settings.pso.seed = stoull(arg.substr(7));
+        else if (arg.rfind("--model=", 0) == 0)
+            settings.modelFile = arg.substr(8);
+        else if (arg == "--calibrate")
+            settings.calibrate = true;
+        else if (arg.rfind("--surge=", 0) == 0)
+            settings.surge = max(1, stoi(arg.substr(8)));
+        else if (arg.rfind("--requests=", 0) == 0)
+            settings.requests = max(1, stoi(arg.substr(11)));
+        else if (arg == "--quiet")
+            settings.quiet = true;
+        else
+        {
+            cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    CostModel model;
+    if (settings.calibrate)
+    {
+        model = calibrate(settings.quiet);
+        if (!model.save(settings.modelFile))
+        {
+            cerr << "Cannot write cost model to " << settings.modelFile << "\n";
+            return 1;
+        }
+        cout << "Cost model saved to " << settings.modelFile << ": startup " << model.startup << " ms | greedy "
+             << model.greedySort << " n log n + " << model.greedyScan << " nm | local +" << model.localScan
+             << " nm | pso +" << model.psoSetup << " nm + " << model.psoStep << " particles (m + n) per iteration\n";
+        return 0;
+    }
+    if (!model.load(settings.modelFile))
+        cerr << "No cost model in " << settings.modelFile << ", using built-in defaults (run --calibrate)\n";
+
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int numOutposts, numUAVs;
+    cout << "Enter number of outposts: ";
+    cin >> numOutposts;
+    cout << "Enter number of UAVs: ";
+    cin >> numUAVs;
+
+    vector<uav_spec> uavs(numUAVs);
+    cout << "Enter UAV details (ID, weight capacity, energy/km, total energy):\n";
+    for (int i = 0; i < numUAVs; i++)
+    {
+        cin >> uavs[i].id >> uavs[i].capacity >> uavs[i].energy_per_km >> uavs[i].total_energy;
+    }
+
+    double baseX, baseY;
+    cout << "Enter Base Station coordinates (x y): ";
+    cin >> baseX >> baseY;
+
+    vector<uav_outpost> outposts(numOutposts);
+    cout << "Enter Outpost details (ID, medicine, food, weapons, x, y, priority level 1-5):\n";
+    for (int i = 0; i < numOutposts; i++)
+    {
+        cin >> outposts[i].id >> outposts[i].medicine >> outposts[i].food >> outposts[i].weapons >> outposts[i].x >>
+            outposts[i].y >> outposts[i].priority;
+    }
+    cout << "\n";
+
+    uav::Instance instance;
+    instance.uavs = uavs;
+    instance.outposts = outposts;
+    instance.baseX = baseX;
+    instance.baseY = baseY;
+
+    try
+    {
+        uav::validate(instance, settings.pso);
+        if (settings.surge > 0)
+        {
+            runSurge(instance, model, settings);
+            return 0;
+        }
+
+        LoadEstimate load;
+        MetaSolver solver(instance, model, settings, load);
+        cout << "Predicted: greedy " << model.greedy(numOutposts, numUAVs) << " ms | local "
+             << model.local(numOutposts, numUAVs) << " ms | pso "
+             << model.pso(numOutposts, numUAVs, settings.pso.particles, settings.pso.iterations) << " ms\n";
+        Answer answer = solver.solveWithin(
+            settings.budgetMs,
+            [&](double predictedMs) {
+                cout << "Budget infeasible: greedy alone is predicted at " << predictedMs << " ms against "
+                     << settings.budgetMs << " ms; answering late with the full greedy plan\n";
+            },
+            [](const uav::Plan &plan, double ms) {
+                cout << "Greedy answer after " << ms << " ms | Fitness: " << plan.summary.fitness << "\n";
+            });
+        printPlan(answer.plan, settings.quiet);
+        cout << "Best from: " << stageName(answer.stage) << " | Latency: " << answer.latencyMs << " ms of "
+             << settings.budgetMs << " ms" << (answer.degraded ? " | Degraded" : "") << "\n";
+    }
+    catch (const exception &e)
+    {
+        cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
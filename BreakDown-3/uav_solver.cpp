@@ -0,0 +1,721 @@
+#include "uav_solver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+namespace uav
+{
+    const double UNSERVED_PENALTY = 1000.0; // Per priority level left unserved (v23)
+    const double MUTATION_RATE = 0.02;
+    const double SPEED = 10.0;       // v8: distance units per time unit
+    const size_t CHECK_WORK = 16384; // Outposts set up, UAVs examined or heap pops between cancellation checks
+
+    double calculateDistance(double x1, double y1, double x2, double y2)
+    {
+        return sqrt(pow(x2 - x1, 2) + pow(y2 - y1, 2));
+    }
+
+    // Shared by the handle and the worker thread
+    struct SolveState
+    {
+        atomic<bool> cancelled{false};
+        atomic<double> progress{0.0};
+        atomic<uint64_t> version{0};
+        mutable mutex bestMutex;
+        Plan best;
+        shared_future<uav_status> result;
+        thread worker;
+
+        bool stopRequested() const { return cancelled.load(memory_order_relaxed); }
+
+        void publish(Plan plan)
+        {
+            lock_guard<mutex> lock(bestMutex);
+            plan.summary.version = version.load(memory_order_relaxed) + 1;
+            best = move(plan);
+            version.store(best.summary.version, memory_order_release);
+        }
+    };
+
+    // The instance plus what every solver derives from it. Only the distances
+    // are new storage; the instance itself is read through its spans. Setup is
+    // O(n log n) and checks for cancellation, so a solve stopped before it
+    // gets going does not first pay for a large instance.
+    struct Problem
+    {
+        const Instance &in;
+        vector<double> distance; // Base to each outpost
+        vector<int> byPriority;  // Outpost indices, highest priority first, ties in input order
+        bool ready = false;      // False if cancelled during setup; only an empty plan is valid then
+
+        Problem(const Instance &instance, const SolveState &state)
+            : in(instance), distance(instance.outposts.size()), byPriority(instance.outposts.size())
+        {
+            for (size_t o = 0; o < distance.size(); o++)
+            {
+                if (o % CHECK_WORK == 0 && state.stopRequested())
+                    return;
+                distance[o] = calculateDistance(in.baseX, in.baseY, in.outposts[o].x, in.outposts[o].y);
+                byPriority[o] = o;
+            }
+            if (state.stopRequested())
+                return;
+            stable_sort(byPriority.begin(), byPriority.end(),
+                        [&](int a, int b) { return in.outposts[a].priority > in.outposts[b].priority; });
+            ready = true;
+        }
+
+        double energyCost(int u, int o) const { return distance[o] * in.uavs[u].energy_per_km; }
+    };
+
+    // -----------------------------------------------------------------------
+    // One outpost per UAV (v7, v23). An assignment maps each UAV to an outpost
+    // index, or -1 when idle.
+    // -----------------------------------------------------------------------
+
+    double evaluate(const Problem &p, const vector<int> &assignment)
+    {
+        double total = 0.0;
+        vector<bool> served(p.in.outposts.size(), false);
+        for (size_t u = 0; u < assignment.size(); u++)
+            if (assignment[u] >= 0)
+            {
+                total += p.energyCost(u, assignment[u]);
+                served[assignment[u]] = true;
+            }
+        for (size_t o = 0; o < served.size(); o++)
+            if (!served[o])
+                total += UNSERVED_PENALTY * p.in.outposts[o].priority;
+        return total;
+    }
+
+    // Drop out-of-range UAVs and second visits to the same outpost
+    void repair(const Problem &p, vector<int> &assignment)
+    {
+        vector<bool> taken(p.in.outposts.size(), false);
+        for (size_t u = 0; u < assignment.size(); u++)
+        {
+            int o = assignment[u];
+            if (o < 0)
+                continue;
+            if (taken[o] || p.energyCost(u, o) > p.in.uavs[u].total_energy)
+                assignment[u] = -1;
+            else
+                taken[o] = true;
+        }
+    }
+
+    Plan toPlan(const Problem &p, const vector<int> &assignment)
+    {
+        Plan plan;
+        for (size_t u = 0; u < assignment.size(); u++)
+            if (assignment[u] >= 0)
+            {
+                double energy = p.energyCost(u, assignment[u]);
+                plan.assignments.push_back({p.in.uavs[u].id, p.in.outposts[assignment[u]].id, energy, 0.0});
+                plan.summary.total_energy += energy;
+            }
+        plan.summary.assigned = plan.assignments.size();
+        plan.summary.unreachable = p.in.outposts.size() - plan.summary.assigned;
+        plan.summary.fitness = evaluate(p, assignment);
+        return plan;
+    }
+
+    // v7: highest priority outposts first, each to the first idle UAV that can
+    // reach it. Returns false if cancelled part way; the assignment is then
+    // still valid, just incomplete.
+    bool greedyFill(const Problem &p, vector<int> &assignment, SolveState &state, double progressShare)
+    {
+        size_t n = p.byPriority.size(), idle = 0, work = 0, nextCheck = 0;
+        vector<bool> taken(p.in.outposts.size(), false);
+        for (int o : assignment)
+            if (o >= 0)
+                taken[o] = true;
+            else
+                idle++;
+        for (size_t k = 0; k < n && idle > 0; k++)
+        {
+            if (work >= nextCheck)
+            {
+                if (state.stopRequested())
+                    return false;
+                state.progress.store(progressShare * k / n, memory_order_relaxed);
+                nextCheck = work + CHECK_WORK;
+            }
+            int o = p.byPriority[k];
+            work++;
+            if (taken[o])
+                continue;
+            for (size_t u = 0; u < assignment.size(); u++, work++)
+                if (assignment[u] < 0 && p.energyCost(u, o) <= p.in.uavs[u].total_energy)
+                {
+                    assignment[u] = o;
+                    taken[o] = true;
+                    idle--;
+                    break;
+                }
+        }
+        return true;
+    }
+
+    // Outposts each UAV can reach. Returns false if cancelled part way.
+    bool reachLists(const Problem &p, const SolveState &state, vector<vector<int>> &reach)
+    {
+        reach.assign(p.in.uavs.size(), {});
+        for (size_t u = 0; u < reach.size(); u++)
+        {
+            if (state.stopRequested())
+                return false;
+            for (size_t o = 0; o < p.in.outposts.size(); o++)
+                if (p.energyCost(u, o) <= p.in.uavs[u].total_energy)
+                    reach[u].push_back(o);
+        }
+        return true;
+    }
+
+    uav_status runGreedy(const Problem &p, SolveState &state)
+    {
+        vector<int> assignment(p.in.uavs.size(), -1);
+        bool finished = greedyFill(p, assignment, state, 1.0);
+        state.publish(toPlan(p, assignment));
+        return finished ? UAV_OK : UAV_CANCELLED;
+    }
+
+    // -----------------------------------------------------------------------
+    // v8 scheduler: every outpost in priority order goes to the earliest
+    // available UAV with enough energy for the round trip
+    // -----------------------------------------------------------------------
+
+    uav_status runSchedule(const Problem &p, SolveState &state)
+    {
+        typedef pair<double, int> Task; // (available time, UAV index)
+        priority_queue<Task, vector<Task>, greater<Task>> pq;
+        for (size_t u = 0; u < p.in.uavs.size(); u++)
+            pq.push({0.0, (int)u});
+
+        Plan plan;
+        size_t n = p.byPriority.size(), k = 0, work = 0, nextCheck = 0;
+        bool finished = true;
+        vector<Task> skipped;
+        for (; k < n; k++)
+        {
+            // Counted in heap pops: an outpost few UAVs can reach pops most of the fleet
+            if (work >= nextCheck)
+            {
+                if (state.stopRequested())
+                {
+                    finished = false;
+                    break;
+                }
+                state.progress.store((double)k / n, memory_order_relaxed);
+                nextCheck = work + CHECK_WORK;
+            }
+            work++;
+            int o = p.byPriority[k];
+            double travelTime = p.distance[o] / SPEED;
+            skipped.clear();
+            bool assigned = false;
+            while (!pq.empty())
+            {
+                Task task = pq.top();
+                pq.pop();
+                work++;
+                double energyCost = p.energyCost(task.second, o) * 2; // Round trip
+                if (energyCost <= p.in.uavs[task.second].total_energy)
+                {
+                    double availableAgain = task.first + 2 * travelTime;
+                    plan.assignments.push_back({p.in.uavs[task.second].id, p.in.outposts[o].id, energyCost, task.first});
+                    plan.summary.total_energy += energyCost;
+                    plan.summary.makespan = max(plan.summary.makespan, availableAgain);
+                    pq.push({availableAgain, task.second});
+                    assigned = true;
+                    break;
+                }
+                skipped.push_back(task);
+            }
+            for (const auto &task : skipped)
+                pq.push(task);
+            if (!assigned)
+                plan.summary.unreachable++;
+        }
+        plan.summary.unreachable += n - k; // Not reached before cancellation
+        plan.summary.assigned = plan.assignments.size();
+        plan.summary.fitness = plan.summary.makespan;
+        state.publish(move(plan));
+        return finished ? UAV_OK : UAV_CANCELLED;
+    }
+
+    // -----------------------------------------------------------------------
+    // Local search from the greedy plan, on the v23 fitness. Each pass tries,
+    // for every UAV, the best switch to an unserved outpost it can reach (a
+    // higher priority, or the same priority for less energy), then swaps of
+    // outposts between UAV pairs that lower the energy. Passes repeat until
+    // nothing improves; cancellation is checked every LOCAL_CHECK_EVERY UAVs.
+    // -----------------------------------------------------------------------
+
+    const size_t LOCAL_CHECK_EVERY = 64;
+    const int MAX_LOCAL_PASSES = 1000;
+
+    uav_status runLocal(const Problem &p, SolveState &state)
+    {
+        const double SEED_SHARE = 0.2;
+        const double EPSILON = 1e-9;
+        size_t m = p.in.uavs.size();
+        vector<int> assignment(m, -1);
+        bool finished = greedyFill(p, assignment, state, SEED_SHARE);
+        state.publish(toPlan(p, assignment));
+        if (!finished)
+            return UAV_CANCELLED;
+
+        vector<vector<int>> reach;
+        if (!reachLists(p, state, reach))
+            return UAV_CANCELLED;
+        vector<int> owner(p.in.outposts.size(), -1);
+        for (size_t u = 0; u < m; u++)
+            if (assignment[u] >= 0)
+                owner[assignment[u]] = u;
+        // What serving outpost o with UAV u is worth: the penalty it avoids less the energy it costs
+        auto value = [&](size_t u, int o) {
+            return o < 0 ? 0.0 : UNSERVED_PENALTY * p.in.outposts[o].priority - p.energyCost(u, o);
+        };
+        auto feasible = [&](size_t u, int o) { return o < 0 || p.energyCost(u, o) <= p.in.uavs[u].total_energy; };
+
+        for (int pass = 1; pass <= MAX_LOCAL_PASSES; pass++)
+        {
+            bool improved = false;
+            for (size_t u = 0; u < m; u++)
+            {
+                if (u % LOCAL_CHECK_EVERY == 0 && state.stopRequested())
+                {
+                    state.publish(toPlan(p, assignment));
+                    return UAV_CANCELLED;
+                }
+                int current = assignment[u], bestOutpost = current;
+                double bestValue = value(u, current);
+                for (int o : reach[u])
+                    if (owner[o] < 0 && value(u, o) > bestValue + EPSILON)
+                    {
+                        bestValue = value(u, o);
+                        bestOutpost = o;
+                    }
+                if (bestOutpost != current)
+                {
+                    if (current >= 0)
+                        owner[current] = -1;
+                    owner[bestOutpost] = u;
+                    assignment[u] = bestOutpost;
+                    improved = true;
+                }
+            }
+            for (size_t u = 0; u < m; u++)
+            {
+                if (u % LOCAL_CHECK_EVERY == 0 && state.stopRequested())
+                {
+                    state.publish(toPlan(p, assignment));
+                    return UAV_CANCELLED;
+                }
+                for (size_t v = u + 1; v < m; v++)
+                {
+                    int a = assignment[u], b = assignment[v];
+                    if (a == b || !feasible(u, b) || !feasible(v, a))
+                        continue;
+                    if (value(u, b) + value(v, a) > value(u, a) + value(v, b) + EPSILON)
+                    {
+                        assignment[u] = b;
+                        assignment[v] = a;
+                        if (a >= 0)
+                            owner[a] = v;
+                        if (b >= 0)
+                            owner[b] = u;
+                        improved = true;
+                    }
+                }
+            }
+            state.progress.store(SEED_SHARE + (1 - SEED_SHARE) * pass / (pass + 1.0), memory_order_relaxed);
+            if (!improved)
+                break;
+            state.publish(toPlan(p, assignment));
+        }
+        state.publish(toPlan(p, assignment));
+        return UAV_OK;
+    }
+
+    // -----------------------------------------------------------------------
+    // PSO over per-UAV genes (v6 update rule), seeded with the greedy plan as
+    // in v23. Cancellation is checked between iterations.
+    // -----------------------------------------------------------------------
+
+    struct Particle
+    {
+        vector<int> position, best;
+        double fitness, bestFitness;
+    };
+
+    uav_status runPso(const Problem &p, const uav_options &options, SolveState &state)
+    {
+        const double SEED_SHARE = 0.1; // Progress credited to the greedy seed
+        size_t m = p.in.uavs.size();
+
+        vector<int> seed(m, -1);
+        if (!greedyFill(p, seed, state, SEED_SHARE))
+        {
+            state.publish(toPlan(p, seed));
+            return UAV_CANCELLED;
+        }
+        double bestFitness = evaluate(p, seed);
+        vector<int> bestAssignment = seed;
+        state.publish(toPlan(p, seed));
+
+        vector<vector<int>> reach;
+        if (!reachLists(p, state, reach))
+            return UAV_CANCELLED;
+
+        mt19937 rng(options.seed);
+        uniform_real_distribution<double> unit(0.0, 1.0);
+        auto randomGene = [&](size_t u) {
+            uniform_int_distribution<int> pick(0, reach[u].size()); // reach.size() means idle
+            int k = pick(rng);
+            return k < (int)reach[u].size() ? reach[u][k] : -1;
+        };
+
+        vector<Particle> swarm(options.particles);
+        for (size_t i = 0; i < swarm.size(); i++)
+        {
+            auto &particle = swarm[i];
+            if (i == 0)
+                particle.position = seed;
+            else
+            {
+                particle.position.resize(m);
+                for (size_t u = 0; u < m; u++)
+                    particle.position[u] = randomGene(u);
+                repair(p, particle.position);
+            }
+            particle.fitness = particle.bestFitness = evaluate(p, particle.position);
+            particle.best = particle.position;
+            if (particle.fitness < bestFitness)
+            {
+                bestFitness = particle.fitness;
+                bestAssignment = particle.position;
+            }
+        }
+
+        int lastImprovement = 0;
+        for (int iter = 1; iter <= options.iterations && iter - lastImprovement <= options.patience; iter++)
+        {
+            if (state.stopRequested())
+            {
+                state.publish(toPlan(p, bestAssignment));
+                return UAV_CANCELLED;
+            }
+            state.progress.store(SEED_SHARE + (1 - SEED_SHARE) * (iter - 1) / options.iterations,
+                                 memory_order_relaxed);
+            for (auto &particle : swarm)
+            {
+                for (size_t u = 0; u < m; u++)
+                {
+                    if (unit(rng) < MUTATION_RATE)
+                        particle.position[u] = randomGene(u);
+                    else
+                        particle.position[u] = (rng() & 1) ? particle.best[u] : bestAssignment[u];
+                }
+                repair(p, particle.position);
+                particle.fitness = evaluate(p, particle.position);
+                if (particle.fitness < particle.bestFitness)
+                {
+                    particle.bestFitness = particle.fitness;
+                    particle.best = particle.position;
+                }
+            }
+            bool improved = false;
+            for (const auto &particle : swarm)
+                if (particle.fitness < bestFitness)
+                {
+                    bestFitness = particle.fitness;
+                    bestAssignment = particle.position;
+                    improved = true;
+                }
+            if (improved)
+            {
+                lastImprovement = iter;
+                state.publish(toPlan(p, bestAssignment));
+            }
+        }
+        state.publish(toPlan(p, bestAssignment));
+        return UAV_OK;
+    }
+
+    uav_status run(const Instance &instance, const uav_options &options, SolveState &state)
+    {
+        Problem problem(instance, state);
+        if (!problem.ready)
+        {
+            // Nothing solved yet: every outpost unserved
+            Plan empty;
+            if (options.solver == UAV_SOLVER_SCHEDULE)
+                empty.summary.unreachable = instance.outposts.size();
+            else
+                empty = toPlan(problem, vector<int>(instance.uavs.size(), -1));
+            state.publish(move(empty));
+            return UAV_CANCELLED;
+        }
+        uav_status status = UAV_INTERNAL_ERROR;
+        switch (options.solver)
+        {
+        case UAV_SOLVER_GREEDY:
+            status = runGreedy(problem, state);
+            break;
+        case UAV_SOLVER_SCHEDULE:
+            status = runSchedule(problem, state);
+            break;
+        case UAV_SOLVER_PSO:
+            status = runPso(problem, options, state);
+            break;
+        case UAV_SOLVER_LOCAL:
+            status = runLocal(problem, state);
+            break;
+        }
+        if (status == UAV_OK)
+            state.progress.store(1.0, memory_order_relaxed);
+        return status;
+    }
+
+    // -----------------------------------------------------------------------
+    // C++ API
+    // -----------------------------------------------------------------------
+
+    uav_options defaultOptions()
+    {
+        uav_options options;
+        options.solver = UAV_SOLVER_PSO;
+        options.particles = 50;
+        options.iterations = 100;
+        options.patience = 100;
+        options.seed = 42;
+        return options;
+    }
+
+    void validate(const Instance &instance, const uav_options &options)
+    {
+        auto fail = [](const string &what) { throw invalid_argument(what); };
+        if ((instance.uavs.data() == nullptr && !instance.uavs.empty()) ||
+            (instance.outposts.data() == nullptr && !instance.outposts.empty()))
+            fail("null instance array with non-zero size");
+        if (!isfinite(instance.baseX) || !isfinite(instance.baseY))
+            fail("base coordinates must be finite");
+        for (size_t u = 0; u < instance.uavs.size(); u++)
+        {
+            const auto &spec = instance.uavs[u];
+            if (!(spec.energy_per_km >= 0) || !(spec.total_energy >= 0) || !isfinite(spec.energy_per_km) ||
+                !isfinite(spec.total_energy))
+                fail("UAV " + to_string(spec.id) + ": energy values must be finite and non-negative");
+        }
+        for (size_t o = 0; o < instance.outposts.size(); o++)
+        {
+            const auto &outpost = instance.outposts[o];
+            if (!isfinite(outpost.x) || !isfinite(outpost.y))
+                fail("outpost " + to_string(outpost.id) + ": coordinates must be finite");
+        }
+        if (options.solver < UAV_SOLVER_GREEDY || options.solver > UAV_SOLVER_LOCAL)
+            fail("unknown solver " + to_string(options.solver));
+        if (options.particles < 1 || options.iterations < 0 || options.patience < 0)
+            fail("particles must be positive, iterations and patience non-negative");
+    }
+
+    Solve::Solve(unique_ptr<SolveState> state) : state(move(state)) {}
+
+    Solve::Solve(Solve &&) noexcept = default;
+
+    Solve &Solve::operator=(Solve &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Solve previous(move(state)); // Cancelled and joined when it goes out of scope
+            state = move(other.state);
+        }
+        return *this;
+    }
+
+    Solve::~Solve()
+    {
+        if (state && state->worker.joinable())
+        {
+            state->cancelled = true;
+            state->worker.join();
+        }
+    }
+
+    double Solve::progress() const { return state->progress.load(memory_order_relaxed); }
+
+    Plan Solve::best() const
+    {
+        lock_guard<mutex> lock(state->bestMutex);
+        return state->best;
+    }
+
+    uint64_t Solve::version() const { return state->version.load(memory_order_acquire); }
+
+    void Solve::cancel() { state->cancelled = true; }
+
+    bool Solve::done() const { return state->result.wait_for(chrono::seconds(0)) == future_status::ready; }
+
+    uav_status Solve::wait() { return state->result.get(); }
+
+    uav_status Solve::waitFor(chrono::milliseconds timeout)
+    {
+        if (state->result.wait_for(timeout) != future_status::ready)
+            return UAV_RUNNING;
+        return state->result.get();
+    }
+
+    Solve solveAsync(const Instance &instance, const uav_options &options)
+    {
+        validate(instance, options);
+        auto state = make_unique<SolveState>();
+        promise<uav_status> done;
+        state->result = done.get_future().share();
+        SolveState *shared = state.get();
+        state->worker = thread([instance, options, shared, done = move(done)]() mutable {
+            uav_status status;
+            try
+            {
+                status = run(instance, options, *shared);
+            }
+            catch (...)
+            {
+                status = UAV_INTERNAL_ERROR;
+            }
+            done.set_value(status);
+        });
+        return Solve(move(state));
+    }
+
+    Plan solve(const Instance &instance, const uav_options &options)
+    {
+        validate(instance, options);
+        SolveState state;
+        run(instance, options, state);
+        return state.best;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// C ABI. Exceptions never cross it: they become status codes.
+// ---------------------------------------------------------------------------
+
+struct uav_solve
+{
+    uav::Solve solve;
+};
+
+extern "C"
+{
+    void uav_default_options(uav_options *options)
+    {
+        if (options)
+            *options = uav::defaultOptions();
+    }
+
+    uav_status uav_solve_start(const uav_spec *uavs, size_t num_uavs, const uav_outpost *outposts,
+                               size_t num_outposts, double base_x, double base_y, const uav_options *options,
+                               uav_solve **out)
+    {
+        if (!out)
+            return UAV_INVALID_ARGUMENT;
+        *out = nullptr;
+        uav::Instance instance;
+        instance.uavs = uav::Span<uav_spec>(uavs, num_uavs);
+        instance.outposts = uav::Span<uav_outpost>(outposts, num_outposts);
+        instance.baseX = base_x;
+        instance.baseY = base_y;
+        try
+        {
+            *out = new uav_solve{uav::solveAsync(instance, options ? *options : uav::defaultOptions())};
+            return UAV_OK;
+        }
+        catch (const invalid_argument &)
+        {
+            return UAV_INVALID_ARGUMENT;
+        }
+        catch (...)
+        {
+            return UAV_INTERNAL_ERROR;
+        }
+    }
+
+    double uav_solve_progress(const uav_solve *solve)
+    {
+        return solve ? solve->solve.progress() : 0.0;
+    }
+
+    void uav_solve_cancel(uav_solve *solve)
+    {
+        if (solve)
+            solve->solve.cancel();
+    }
+
+    uav_status uav_solve_wait(uav_solve *solve, int timeout_ms)
+    {
+        if (!solve)
+            return UAV_INVALID_ARGUMENT;
+        if (timeout_ms < 0)
+            return solve->solve.wait();
+        return solve->solve.waitFor(chrono::milliseconds(timeout_ms));
+    }
+
+    uav_status uav_solve_best(const uav_solve *solve, uav_assignment *out, size_t capacity, uav_summary *summary)
+    {
+        if (!solve || (!out && capacity > 0))
+            return UAV_INVALID_ARGUMENT;
+        try
+        {
+            uav::Plan plan = solve->solve.best();
+            if (summary)
+                *summary = plan.summary;
+            if (plan.assignments.size() > capacity)
+                return UAV_BUFFER_TOO_SMALL;
+            copy(plan.assignments.begin(), plan.assignments.end(), out);
+            return UAV_OK;
+        }
+        catch (...)
+        {
+            return UAV_INTERNAL_ERROR;
+        }
+    }
+
+    void uav_solve_free(uav_solve *solve)
+    {
+        delete solve;
+    }
+
+    const char *uav_status_string(uav_status status)
+    {
+        switch (status)
+        {
+        case UAV_OK:
+            return "ok";
+        case UAV_RUNNING:
+            return "running";
+        case UAV_CANCELLED:
+            return "cancelled";
+        case UAV_INVALID_ARGUMENT:
+            return "invalid argument";
+        case UAV_BUFFER_TOO_SMALL:
+            return "buffer too small";
+        case UAV_INTERNAL_ERROR:
+            return "internal error";
+        }
+        return "unknown status";
+    }
+}
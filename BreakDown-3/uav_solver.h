@@ -0,0 +1,193 @@
+#ifndef UAV_SOLVER_H
+#define UAV_SOLVER_H
+
+/*
+ * UAV allocation as a library. The solvers of v7 (greedy), v8 (scheduler),
+ * v23 (seeded PSO) and v33 (local search) behind one asynchronous entry
+ * point, usable from C++ and through a flat C ABI.
+ *
+ * Instance data is read in place. Nothing is copied, so the arrays passed
+ * to a solve must stay alive and unchanged until that solve has finished.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef enum
+    {
+        UAV_OK = 0,
+        UAV_RUNNING = 1,   /* uav_solve_wait timed out */
+        UAV_CANCELLED = 2, /* Stopped early; the best plan so far is still available */
+        UAV_INVALID_ARGUMENT = -1,
+        UAV_BUFFER_TOO_SMALL = -2,
+        UAV_INTERNAL_ERROR = -3
+    } uav_status;
+
+    typedef enum
+    {
+        UAV_SOLVER_GREEDY = 0,   /* v7: one outpost per UAV, highest priority first */
+        UAV_SOLVER_SCHEDULE = 1, /* v8: repeated round trips, earliest available UAV */
+        UAV_SOLVER_PSO = 2,      /* v23: PSO seeded with the greedy plan */
+        UAV_SOLVER_LOCAL = 3     /* v33: relocate/swap local search from the greedy plan */
+    } uav_solver_kind;
+
+    typedef struct
+    {
+        int id;
+        double capacity;
+        double energy_per_km;
+        double total_energy;
+    } uav_spec;
+
+    typedef struct
+    {
+        int id;
+        int medicine, food, weapons;
+        double x, y;
+        int priority; /* 1-5 */
+    } uav_outpost;
+
+    typedef struct
+    {
+        int solver; /* uav_solver_kind */
+        int particles;
+        int iterations;
+        int patience; /* PSO: stop after this many iterations without improvement */
+        uint64_t seed;
+    } uav_options;
+
+    typedef struct
+    {
+        int uav_id;
+        int outpost_id;
+        double energy;
+        double departure; /* Schedule solver only, 0 otherwise */
+    } uav_assignment;
+
+    typedef struct
+    {
+        size_t assigned;
+        size_t unreachable; /* Outposts left without a UAV */
+        double total_energy;
+        double makespan;    /* Schedule solver only */
+        double fitness;     /* What the solver minimises: v23 fitness, or makespan for the scheduler */
+        uint64_t version;   /* Bumped whenever a better plan is published */
+    } uav_summary;
+
+    typedef struct uav_solve uav_solve;
+
+    void uav_default_options(uav_options *options);
+
+    /* Starts a solve on a background thread. `options` may be NULL for the defaults. */
+    uav_status uav_solve_start(const uav_spec *uavs, size_t num_uavs, const uav_outpost *outposts,
+                               size_t num_outposts, double base_x, double base_y, const uav_options *options,
+                               uav_solve **out);
+
+    /* Fraction of the solve done, from 0 to 1 */
+    double uav_solve_progress(const uav_solve *solve);
+
+    /* Asks the solver to stop at its next iteration boundary; does not wait */
+    void uav_solve_cancel(uav_solve *solve);
+
+    /* Waits up to timeout_ms (negative: forever). Returns UAV_RUNNING on timeout, else the final status. */
+    uav_status uav_solve_wait(uav_solve *solve, int timeout_ms);
+
+    /*
+     * Copies the best plan so far. `summary` may be NULL. If `capacity` is too
+     * small nothing is copied, UAV_BUFFER_TOO_SMALL is returned and
+     * summary->assigned says how many entries are needed.
+     */
+    uav_status uav_solve_best(const uav_solve *solve, uav_assignment *out, size_t capacity, uav_summary *summary);
+
+    /* Cancels if still running, waits for the worker and releases the handle */
+    void uav_solve_free(uav_solve *solve);
+
+    const char *uav_status_string(uav_status status);
+
+#ifdef __cplusplus
+}
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace uav
+{
+    // Read-only view over contiguous instance data (std::span is C++20)
+    template <typename T>
+    class Span
+    {
+    public:
+        Span() = default;
+        Span(const T *data, size_t size) : ptr(data), len(size) {}
+        Span(const std::vector<T> &v) : ptr(v.data()), len(v.size()) {}
+
+        const T *data() const { return ptr; }
+        size_t size() const { return len; }
+        bool empty() const { return len == 0; }
+        const T &operator[](size_t i) const { return ptr[i]; }
+        const T *begin() const { return ptr; }
+        const T *end() const { return ptr + len; }
+
+    private:
+        const T *ptr = nullptr;
+        size_t len = 0;
+    };
+
+    struct Instance
+    {
+        Span<uav_spec> uavs;
+        Span<uav_outpost> outposts;
+        double baseX = 0, baseY = 0;
+    };
+
+    struct Plan
+    {
+        std::vector<uav_assignment> assignments;
+        uav_summary summary{};
+    };
+
+    uav_options defaultOptions();
+
+    // Throws std::invalid_argument naming the first problem found
+    void validate(const Instance &instance, const uav_options &options);
+
+    struct SolveState;
+
+    // Handle to a running solve. Destroying it cancels the solve and waits for it.
+    class Solve
+    {
+    public:
+        Solve(Solve &&) noexcept;
+        Solve &operator=(Solve &&) noexcept;
+        ~Solve();
+
+        double progress() const;
+        Plan best() const;
+        uint64_t version() const; // Cheap check for a new best plan
+        void cancel();
+        bool done() const;
+
+        uav_status wait();
+        uav_status waitFor(std::chrono::milliseconds timeout); // UAV_RUNNING on timeout
+
+    private:
+        friend Solve solveAsync(const Instance &, const uav_options &);
+        explicit Solve(std::unique_ptr<SolveState> state);
+        std::unique_ptr<SolveState> state;
+    };
+
+    Solve solveAsync(const Instance &instance, const uav_options &options = defaultOptions());
+
+    // Runs on the calling thread
+    Plan solve(const Instance &instance, const uav_options &options = defaultOptions());
+}
+
+#endif
+
+#endif
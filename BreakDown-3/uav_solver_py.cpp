@@ -0,0 +1,425 @@
+// Python bindings for the solver library (v28). Instance arrays are read in
+// place through the buffer protocol; the GIL is released while solving.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "uav_solver.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Field type codes and byte offsets of each record, as the C structs lay them out
+const char *const UAV_CODES = "iddd";
+const size_t UAV_OFFSETS[] = {offsetof(uav_spec, id), offsetof(uav_spec, capacity),
+                              offsetof(uav_spec, energy_per_km), offsetof(uav_spec, total_energy)};
+const char *const OUTPOST_CODES = "iiiiddi";
+const size_t OUTPOST_OFFSETS[] = {offsetof(uav_outpost, id),      offsetof(uav_outpost, medicine),
+                                  offsetof(uav_outpost, food),    offsetof(uav_outpost, weapons),
+                                  offsetof(uav_outpost, x),       offsetof(uav_outpost, y),
+                                  offsetof(uav_outpost, priority)};
+
+// Type codes and byte offsets of a struct format such as "T{<i:id:4x<d:x:}",
+// walked the way the struct module lays it out: '@' (the default) aligns each
+// field to its size, '<', '=' and '^' do not, 'x' and repeat counts add bytes.
+// Returns false on anything that is not a flat little-endian/native struct of
+// int32 and double fields.
+bool structFields(const char *format, string &codes, vector<size_t> &offsets)
+{
+    if (!format || strncmp(format, "T{", 2) != 0)
+        return false;
+    bool aligned = true, nativeSizes = true;
+    size_t pos = 0;
+    for (const char *c = format + 2; *c && *c != '}'; c++)
+    {
+        if (*c == '>' || *c == '!' || *c == '(' || *c == 'T')
+            return false; // Big-endian, sub-arrays and nested structs never match
+        if (*c == '@' || *c == '<' || *c == '=' || *c == '^')
+        {
+            aligned = *c == '@';
+            nativeSizes = *c == '@' || *c == '^';
+            continue;
+        }
+        if (*c == ':')
+        {
+            c = strchr(c + 1, ':');
+            if (!c)
+                return false;
+            continue;
+        }
+        size_t count = 1;
+        if (isdigit((unsigned char)*c))
+        {
+            char *end;
+            count = strtoul(c, &end, 10);
+            c = end;
+        }
+        size_t size;
+        char code = *c;
+        if (code == 'x')
+        {
+            pos += count;
+            continue;
+        }
+        if (code == 'i')
+            size = 4;
+        else if (code == 'l' && (!nativeSizes || sizeof(long) == 4))
+        {
+            size = 4; // How some exporters spell int32
+            code = 'i';
+        }
+        else if (code == 'd')
+            size = 8;
+        else
+            return false;
+        if (aligned)
+            pos = (pos + size - 1) / size * size;
+        for (size_t k = 0; k < count; k++, pos += size)
+        {
+            codes += code;
+            offsets.push_back(pos);
+        }
+    }
+    return true;
+}
+
+// ctypes exports struct formats without their alignment padding, so a
+// ctypes array's field offsets are taken from its structure's field
+// descriptors instead. Returns false if obj is not an array of ctypes structures.
+bool ctypesOffsets(PyObject *obj, vector<size_t> &offsets)
+{
+    PyObject *element = PyObject_GetAttrString((PyObject *)Py_TYPE(obj), "_type_");
+    PyObject *fields = element ? PyObject_GetAttrString(element, "_fields_") : nullptr;
+    PyErr_Clear();
+    bool ok = fields && PySequence_Check(fields);
+    for (Py_ssize_t i = 0; ok && i < PySequence_Size(fields); i++)
+    {
+        PyObject *field = PySequence_GetItem(fields, i);
+        PyObject *name = field && PyTuple_Check(field) && PyTuple_GET_SIZE(field) >= 2 ? PyTuple_GET_ITEM(field, 0)
+                                                                                         : nullptr;
+        PyObject *descriptor = name ? PyObject_GetAttr(element, name) : nullptr;
+        PyObject *offset = descriptor ? PyObject_GetAttrString(descriptor, "offset") : nullptr;
+        ok = offset && PyLong_Check(offset);
+        if (ok)
+            offsets.push_back(PyLong_AsSize_t(offset));
+        Py_XDECREF(offset);
+        Py_XDECREF(descriptor);
+        Py_XDECREF(field);
+        PyErr_Clear();
+    }
+    Py_XDECREF(fields);
+    Py_XDECREF(element);
+    return ok;
+}
+
+// A record array borrowed from Python: either a view of the caller's buffer
+// (no copy) or, when the object has no usable buffer, a packed copy
+template <typename T>
+class Records
+{
+public:
+    Records() { view.obj = nullptr; }
+    ~Records()
+    {
+        if (view.obj)
+            PyBuffer_Release(&view);
+    }
+    Records(const Records &) = delete;
+    Records &operator=(const Records &) = delete;
+
+    const T *data() const { return borrowed ? borrowed : packed.data(); }
+    size_t size() const { return count; }
+
+    // Returns false with a Python exception set
+    bool load(PyObject *obj, const char *codes, const size_t *offsets, const char *name,
+              bool (*parse)(PyObject *, T &))
+    {
+        if (PyObject_CheckBuffer(obj))
+        {
+            if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+                return false;
+            string found;
+            vector<size_t> at, ctypesAt;
+            bool bytes = !view.format || strcmp(view.format, "B") == 0 || strcmp(view.format, "b") == 0;
+            bool records = !bytes && view.itemsize == (Py_ssize_t)sizeof(T) && structFields(view.format, found, at) &&
+                           found == codes;
+            if (records && ctypesOffsets(obj, ctypesAt) && ctypesAt.size() == at.size())
+                at = ctypesAt;
+            for (size_t i = 0; records && i < at.size(); i++)
+                records = at[i] == offsets[i];
+            if (!(bytes || records) || view.len % sizeof(T) != 0)
+            {
+                PyErr_Format(PyExc_TypeError,
+                             "%s: buffer layout does not match the C struct (format %s, itemsize %zd; "
+                             "expected %zu-byte records of '%s' at the offsets of %s_DTYPE)",
+                             name, view.format ? view.format : "B", view.itemsize, sizeof(T), codes,
+                             codes == UAV_CODES ? "UAV" : "OUTPOST");
+                return false;
+            }
+            count = view.len / sizeof(T);
+            if ((uintptr_t)view.buf % alignof(T) == 0)
+                borrowed = static_cast<const T *>(view.buf);
+            else
+            {
+                packed.resize(count); // Misaligned bytes: one copy keeps the loads legal
+                memcpy(packed.data(), view.buf, view.len);
+            }
+            return true;
+        }
+
+        // Fallback: any sequence of tuples, packed once
+        PyObject *seq = PySequence_Fast(obj, "expected a buffer of records or a sequence of tuples");
+        if (!seq)
+            return false;
+        Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+        packed.resize(n);
+        for (Py_ssize_t i = 0; i < n; i++)
+            if (!parse(PySequence_Fast_GET_ITEM(seq, i), packed[i]))
+            {
+                Py_DECREF(seq);
+                PyErr_Format(PyExc_TypeError, "%s[%zd]: expected a tuple of (%s)", name, i,
+                             codes == UAV_CODES ? "id, capacity, energy_per_km, total_energy"
+                                                : "id, medicine, food, weapons, x, y, priority");
+                return false;
+            }
+        Py_DECREF(seq);
+        count = n;
+        return true;
+    }
+
+private:
+    Py_buffer view;
+    const T *borrowed = nullptr;
+    vector<T> packed;
+    size_t count = 0;
+};
+
+bool parseUAV(PyObject *item, uav_spec &u)
+{
+    return PyArg_ParseTuple(item, "iddd", &u.id, &u.capacity, &u.energy_per_km, &u.total_energy);
+}
+
+bool parseOutpost(PyObject *item, uav_outpost &o)
+{
+    return PyArg_ParseTuple(item, "iiiiddi", &o.id, &o.medicine, &o.food, &o.weapons, &o.x, &o.y, &o.priority);
+}
+
+// numpy.frombuffer if NumPy can be imported, else nullptr. Looked up once, on
+// the first result, so importing the module does not pull NumPy in.
+PyObject *numpyFrombuffer()
+{
+    static PyObject *frombuffer = nullptr;
+    static bool looked = false;
+    if (!looked)
+    {
+        looked = true;
+        PyObject *numpy = PyImport_ImportModule("numpy");
+        if (numpy)
+        {
+            frombuffer = PyObject_GetAttrString(numpy, "frombuffer");
+            Py_DECREF(numpy);
+        }
+        PyErr_Clear();
+    }
+    return frombuffer;
+}
+
+// One column of the plan, filled from a strided field: a numpy.ndarray with
+// NumPy, an array.array of the same type code without it
+PyObject *column(PyObject *arrayType, const char *code, const vector<uav_assignment> &plan, size_t offset,
+                 size_t width)
+{
+    vector<char> bytes(plan.size() * width);
+    for (size_t i = 0; i < plan.size(); i++)
+        memcpy(&bytes[i * width], reinterpret_cast<const char *>(&plan[i]) + offset, width);
+    if (PyObject *frombuffer = numpyFrombuffer())
+    {
+        // Over a bytearray, so the array is writable and owns its memory through it
+        PyObject *buffer = PyByteArray_FromStringAndSize(bytes.data(), (Py_ssize_t)bytes.size());
+        if (!buffer)
+            return nullptr;
+        PyObject *array = PyObject_CallFunction(frombuffer, "Os", buffer, code);
+        Py_DECREF(buffer);
+        return array;
+    }
+    return PyObject_CallFunction(arrayType, "sy#", code, bytes.data(), (Py_ssize_t)bytes.size());
+}
+
+PyObject *toResult(const uav::Plan &plan, uav_status status)
+{
+    PyObject *arrayModule = PyImport_ImportModule("array");
+    if (!arrayModule)
+        return nullptr;
+    PyObject *arrayType = PyObject_GetAttrString(arrayModule, "array");
+    Py_DECREF(arrayModule);
+    if (!arrayType)
+        return nullptr;
+
+    PyObject *uavId = column(arrayType, "i", plan.assignments, offsetof(uav_assignment, uav_id), sizeof(int));
+    PyObject *outpostId = column(arrayType, "i", plan.assignments, offsetof(uav_assignment, outpost_id), sizeof(int));
+    PyObject *energy = column(arrayType, "d", plan.assignments, offsetof(uav_assignment, energy), sizeof(double));
+    PyObject *departure =
+        column(arrayType, "d", plan.assignments, offsetof(uav_assignment, departure), sizeof(double));
+    Py_DECREF(arrayType);
+
+    PyObject *result = nullptr;
+    if (uavId && outpostId && energy && departure)
+        result = Py_BuildValue("{s:O,s:O,s:O,s:O,s:s,s:n,s:n,s:d,s:d,s:d,s:K}", "uav_id", uavId, "outpost_id",
+                               outpostId, "energy", energy, "departure", departure, "status",
+                               uav_status_string(status), "assigned", (Py_ssize_t)plan.summary.assigned,
+                               "unreachable", (Py_ssize_t)plan.summary.unreachable, "total_energy",
+                               plan.summary.total_energy, "makespan", plan.summary.makespan, "fitness",
+                               plan.summary.fitness, "improvements", (unsigned long long)plan.summary.version);
+    Py_XDECREF(uavId);
+    Py_XDECREF(outpostId);
+    Py_XDECREF(energy);
+    Py_XDECREF(departure);
+    return result;
+}
+
+bool parseSolver(const char *name, int &solver)
+{
+    if (strcmp(name, "greedy") == 0)
+        solver = UAV_SOLVER_GREEDY;
+    else if (strcmp(name, "schedule") == 0)
+        solver = UAV_SOLVER_SCHEDULE;
+    else if (strcmp(name, "pso") == 0)
+        solver = UAV_SOLVER_PSO;
+    else if (strcmp(name, "local") == 0)
+        solver = UAV_SOLVER_LOCAL;
+    else
+        return false;
+    return true;
+}
+
+const double SIGNAL_CHECK_SECONDS = 0.1; // How often a waiting solve looks for Ctrl-C
+
+PyObject *solve(PyObject *, PyObject *args, PyObject *kwargs)
+{
+    static const char *keywords[] = {"uavs",       "outposts", "base",     "solver", "particles",
+                                     "iterations", "patience", "seed",     "deadline", nullptr};
+    PyObject *uavsObj, *outpostsObj;
+    double baseX = 0, baseY = 0, deadline = -1;
+    const char *solverName = "pso";
+    uav_options options = uav::defaultOptions();
+    unsigned long long seed = options.seed;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|(dd)siiiKd", const_cast<char **>(keywords), &uavsObj,
+                                     &outpostsObj, &baseX, &baseY, &solverName, &options.particles,
+                                     &options.iterations, &options.patience, &seed, &deadline))
+        return nullptr;
+    options.seed = seed;
+    if (!parseSolver(solverName, options.solver))
+    {
+        PyErr_Format(PyExc_ValueError, "unknown solver '%s' (expected greedy, schedule, pso or local)", solverName);
+        return nullptr;
+    }
+
+    Records<uav_spec> uavs;
+    Records<uav_outpost> outposts;
+    if (!uavs.load(uavsObj, UAV_CODES, UAV_OFFSETS, "uavs", parseUAV) ||
+        !outposts.load(outpostsObj, OUTPOST_CODES, OUTPOST_OFFSETS, "outposts", parseOutpost))
+        return nullptr;
+
+    uav::Instance instance;
+    instance.uavs = uav::Span<uav_spec>(uavs.data(), uavs.size());
+    instance.outposts = uav::Span<uav_outpost>(outposts.data(), outposts.size());
+    instance.baseX = baseX;
+    instance.baseY = baseY;
+
+    try
+    {
+        uav::Solve running = uav::solveAsync(instance, options);
+        auto start = chrono::steady_clock::now();
+        uav_status status = UAV_RUNNING;
+        while (status == UAV_RUNNING)
+        {
+            double waitSeconds = SIGNAL_CHECK_SECONDS;
+            if (deadline >= 0)
+            {
+                double left = deadline - chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                if (left <= 0)
+                    running.cancel();
+                waitSeconds = max(0.0, min(waitSeconds, left));
+            }
+            Py_BEGIN_ALLOW_THREADS;
+            status = running.waitFor(chrono::milliseconds((long long)(waitSeconds * 1000)));
+            Py_END_ALLOW_THREADS;
+            if (status == UAV_RUNNING && PyErr_CheckSignals() < 0)
+                return nullptr; // `running` cancels and joins on the way out
+        }
+        if (status == UAV_INTERNAL_ERROR)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "solver failed");
+            return nullptr;
+        }
+        return toResult(running.best(), status);
+    }
+    catch (const invalid_argument &e)
+    {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return nullptr;
+    }
+    catch (const exception &e)
+    {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+// numpy.dtype(spec) of a record array the solver can read without copying
+PyObject *dtypeSpec(const char *const names[], const char *const formats[], const size_t offsets[], size_t count,
+                    size_t itemsize)
+{
+    PyObject *nameList = PyList_New(count), *formatList = PyList_New(count), *offsetList = PyList_New(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        PyList_SET_ITEM(nameList, i, PyUnicode_FromString(names[i]));
+        PyList_SET_ITEM(formatList, i, PyUnicode_FromString(formats[i]));
+        PyList_SET_ITEM(offsetList, i, PyLong_FromSize_t(offsets[i]));
+    }
+    return Py_BuildValue("{s:N,s:N,s:N,s:n}", "names", nameList, "formats", formatList, "offsets", offsetList,
+                         "itemsize", (Py_ssize_t)itemsize);
+}
+
+PyMethodDef methods[] = {
+    {"solve", (PyCFunction)(void (*)(void))solve, METH_VARARGS | METH_KEYWORDS,
+     "solve(uavs, outposts, base=(0, 0), solver='pso', particles=50, iterations=100, patience=100, seed=42, "
+     "deadline=-1)\n\n"
+     "uavs and outposts are record buffers laid out as UAV_DTYPE / OUTPOST_DTYPE (read in place) or sequences "
+     "of tuples (packed once). The GIL is released while solving; deadline is in seconds. Returns a dict of "
+     "columns (uav_id, outpost_id, energy, departure) and the plan summary. The columns are numpy.ndarray "
+     "(int32, float64) when NumPy can be imported, array.array ('i', 'd') otherwise."},
+    {nullptr, nullptr, 0, nullptr}};
+
+PyModuleDef moduleDef = {PyModuleDef_HEAD_INIT, "uav_solver", "UAV allocation solvers (v7 greedy, v8 scheduler, PSO)",
+                         -1, methods, nullptr, nullptr, nullptr, nullptr};
+
+PyMODINIT_FUNC PyInit_uav_solver(void)
+{
+    PyObject *module = PyModule_Create(&moduleDef);
+    if (!module)
+        return nullptr;
+
+    const char *const uavNames[] = {"id", "capacity", "energy_per_km", "total_energy"};
+    const char *const uavFormats[] = {"<i4", "<f8", "<f8", "<f8"};
+    const char *const outpostNames[] = {"id", "medicine", "food", "weapons", "x", "y", "priority"};
+    const char *const outpostFormats[] = {"<i4", "<i4", "<i4", "<i4", "<f8", "<f8", "<i4"};
+
+    if (PyModule_AddObject(module, "UAV_DTYPE", dtypeSpec(uavNames, uavFormats, UAV_OFFSETS, 4, sizeof(uav_spec))) < 0 ||
+        PyModule_AddObject(module, "OUTPOST_DTYPE",
+                           dtypeSpec(outpostNames, outpostFormats, OUTPOST_OFFSETS, 7, sizeof(uav_outpost))) < 0)
+    {
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}